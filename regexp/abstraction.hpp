@@ -22,28 +22,175 @@
 #ifndef __REGEXP__ABSTRACTION__HPP__
 #define __REGEXP__ABSTRACTION__HPP__
 
+#include "scan.hpp"
+
 namespace SRX {
 
 template <typename BaseType, typename CharType, bool (*compare)(CharType, CharType, CharType)> struct StringAbstraction;
 
-template <typename CharType> inline bool charactersAreEqual(CharType a, CharType min, CharType max)
+// compare functions must be constexpr (they are used for building lookup tables in compile-time)
+template <typename CharType> inline constexpr bool charactersAreEqual(CharType a, CharType min, CharType max)
 {
 	return a >= min && a <= max;
 }
 
-inline bool caseSensitive(const char a, const char min, const char max)
+inline constexpr bool caseSensitive(const char a, const char min, const char max)
 {
 	return a >= min && a <= max;
 }
 
-inline bool caseInsensitive(const char a, const char min, const char max)
+inline constexpr char upperCase(const char a)
+{
+	return (a >= 'a' && a <= 'z') ? a - 0x20 : a;
+}
+
+inline constexpr bool caseInsensitive(const char a, const char min, const char max)
 {
-	char pom = (a >= 'a' && a <= 'z') ? a - 0x20 : a;	
-	return (pom >= ((min >= 'a' && min <= 'z') ? min - 0x20 : min) && pom <= ((max >= 'a' && max <= 'z') ? max - 0x20 : max)); 
+	return upperCase(a) >= upperCase(min) && upperCase(a) <= upperCase(max);
 }
 
+// Set is compile-time description of characters which can start a match (see FirstCharacter in regexp.hpp)
+template <typename Set, typename CharType, bool (*equalFnc)(CharType,CharType,CharType)> struct FirstCharacterPredicate
+{
+	static constexpr bool check(const unsigned char c)
+	{
+		return Set::template check<CharType, equalFnc>(static_cast<CharType>(c));
+	}
+};
+
+template <typename SetA, typename SetB, typename CharType, bool (*equalFnc)(CharType,CharType,CharType)> struct CommonCharacterPredicate
+{
+	static constexpr bool check(const unsigned char c)
+	{
+		return FirstCharacterPredicate<SetA, CharType, equalFnc>::check(c) && FirstCharacterPredicate<SetB, CharType, equalFnc>::check(c);
+	}
+};
+
+// sets without common character, it's decidable only for one-byte characters
+template <typename CharType, bool (*equalFnc)(CharType,CharType,CharType), typename SetA, typename SetB> struct DisjointSets
+{
+	static const constexpr bool value{false};
+};
+
+template <bool (*equalFnc)(char,char,char), typename SetA, typename SetB> struct DisjointSets<char, equalFnc, SetA, SetB>
+{
+	static const constexpr bool value{SetA::known && SetB::known && ByteTable<CommonCharacterPredicate<SetA, SetB, char, equalFnc>>::count() == 0};
+};
+
+// membership of character in set, one-byte characters are looked up in table built in compile-time (with compare function already applied)
+template <typename CharType, bool (*equalFnc)(CharType,CharType,CharType), typename Set> struct CharacterSetLookup
+{
+	static inline bool check(const CharType c)
+	{
+		return Set::template check<CharType, equalFnc>(c);
+	}
+};
+
+template <bool (*equalFnc)(char,char,char), typename Set> struct CharacterSetLookup<char, equalFnc, Set>
+{
+	static inline bool check(const char c)
+	{
+		return ByteTable<FirstCharacterPredicate<Set, char, equalFnc>>::data[static_cast<unsigned char>(c)];
+	}
+};
+
+// length of run of characters from Set (see Repeat in regexp.hpp), one-byte characters are scanned for first character out of Set
+template <typename CharType, bool (*equalFnc)(CharType,CharType,CharType), typename Set> struct CharacterRunScanner
+{
+	static inline size_t length(const CharType * str)
+	{
+		const CharType * it{str};
+		while (*it && CharacterSetLookup<CharType, equalFnc, Set>::check(*it)) ++it;
+		return static_cast<size_t>(it - str);
+	}
+	static inline size_t length(const CharType * str, const CharType * end)
+	{
+		const CharType * it{str};
+		while (it != end && CharacterSetLookup<CharType, equalFnc, Set>::check(*it)) ++it;
+		return static_cast<size_t>(it - str);
+	}
+};
+
+template <bool (*equalFnc)(char,char,char), typename Set> struct CharacterRunScanner<char, equalFnc, Set>
+{
+	using Scanner = typename ByteScanner<ByteTable<NegatedPredicate<FirstCharacterPredicate<Set, char, equalFnc>>>>::Type;
+	static inline size_t length(const char * str)
+	{
+		return static_cast<size_t>(Scanner::find(str) - str);
+	}
+	static inline size_t length(const char * str, const char * end)
+	{
+		return static_cast<size_t>(Scanner::find(str, end) - str);
+	}
+};
+
+template <wchar_t... codes> struct CodeList { };
+
+// literal which begins every match of Set (it's specialized for FirstCharacter in regexp.hpp)
+template <typename Set> struct SetLiteral
+{
+	using Type = CodeList<>;
+};
+
+template <bool (*equalFnc)(char,char,char), typename Codes> struct CharacterLiteral;
+
+template <bool (*equalFnc)(char,char,char), wchar_t... codes> struct CharacterLiteral<equalFnc, CodeList<codes...>>
+{
+	static const constexpr size_t length{sizeof...(codes)};
+	static const constexpr char data[sizeof...(codes) ? sizeof...(codes) : 1]{static_cast<char>(codes)...};
+	static constexpr bool check(const size_t i, const unsigned char c)
+	{
+		return equalFnc(static_cast<char>(c), data[i], data[i]);
+	}
+};
+
+template <bool (*equalFnc)(char,char,char), wchar_t... codes> const constexpr char CharacterLiteral<equalFnc, CodeList<codes...>>::data[sizeof...(codes) ? sizeof...(codes) : 1];
+
+// literal of at least 3 characters is searched as whole, otherwise only its first character
+template <typename Literal, typename Bytes, bool whole = (Literal::length >= 3)> struct BoundedScanner
+{
+	static inline const char * find(const char * str, const char * end)
+	{
+		return Bytes::find(str, end);
+	}
+};
+
+template <typename Literal, typename Bytes> struct BoundedScanner<Literal, Bytes, true>
+{
+	static inline const char * find(const char * str, const char * end)
+	{
+		return FindLiteral<Literal>::find(str, end);
+	}
+};
+
+// skipping of positions which can't be begin of match, only for one-byte characters
+template <typename CharType, bool (*equalFnc)(CharType,CharType,CharType), typename Set, bool skippable = Set::skippable> struct FirstCharacterScanner
+{
+	static inline const CharType * find(const CharType * str)
+	{
+		return str;
+	}
+	static inline const CharType * find(const CharType * str, const CharType *)
+	{
+		return str;
+	}
+};
+
+template <bool (*equalFnc)(char,char,char), typename Set> struct FirstCharacterScanner<char, equalFnc, Set, true>
+{
+	static inline const char * find(const char * str)
+	{
+		return ByteScanner<ByteTable<FirstCharacterPredicate<Set, char, equalFnc>>>::Type::find(str);
+	}
+	static inline const char * find(const char * str, const char * end)
+	{
+		return BoundedScanner<CharacterLiteral<equalFnc, typename SetLiteral<Set>::Type>, typename ByteScanner<ByteTable<FirstCharacterPredicate<Set, char, equalFnc>>>::Type>::find(str, end);
+	}
+};
+
 template <typename CharType, bool (*equalFnc)(CharType,CharType,CharType) = charactersAreEqual> struct CharacterAbstraction
 {
+	using CharacterType = CharType;
 	//const size_t cpos;
 	const CharType * str;
 	const CharType * original;
@@ -68,6 +215,14 @@ template <typename CharType, bool (*equalFnc)(CharType,CharType,CharType) = char
 	template <typename CharTypeInner> inline bool charIsBetween(const CharTypeInner a, const CharTypeInner b) const {
 		return (*str >= a) && (*str <= b);
 	}
+	// current character is in Set (see FirstCharacter in regexp.hpp)
+	template <typename Set> inline bool inSet() const {
+		return exists() && CharacterSetLookup<CharType, equalFnc, Set>::check(*str);
+	}
+	// number of characters from Set beginning at current position
+	template <typename Set> inline size_t run() const {
+		return CharacterRunScanner<CharType, equalFnc, Set>::length(str);
+	}
 	inline bool isBegin() const {
 		return getPosition() == 0;
 	}
@@ -77,6 +232,74 @@ template <typename CharType, bool (*equalFnc)(CharType,CharType,CharType) = char
 	inline size_t getPosition() const {
 		return str-original;
 	}
+	// returns first position (from pos) which can be begin of match or end of string
+	template <typename Set> inline size_t skip(const size_t pos) const {
+		return FirstCharacterScanner<CharType, equalFnc, Set>::find(str+pos) - str;
+	}
+	template <typename SetA, typename SetB> static constexpr bool disjoint() {
+		return DisjointSets<CharType, equalFnc, SetA, SetB>::value;
+	}
+	// data built once for compare function of abstraction (Builder::get<CharType, equalFnc>() must return reference to static object)
+	template <typename Builder> static inline const typename Builder::Type & shared() {
+		return Builder::template get<CharType, equalFnc>();
+	}
+};
+
+// length-delimited input (begin/end pointers), doesn't need terminating NUL and can contain NUL characters
+template <typename CharType, bool (*equalFnc)(CharType,CharType,CharType) = charactersAreEqual> struct BoundedCharacterAbstraction
+{
+	using CharacterType = CharType;
+	const CharType * str;
+	const CharType * original;
+	const CharType * last;
+	inline BoundedCharacterAbstraction(const CharType * lstr, const CharType * lstrorig, const CharType * llast): str{lstr}, original{lstrorig}, last{llast} {}
+	inline BoundedCharacterAbstraction(const CharType * lstr, const CharType * llast): str{lstr}, original{lstr}, last{llast} {}
+	inline bool exists(const size_t pos) const {
+		return pos < static_cast<size_t>(last-str);
+	}
+	inline bool exists() const {
+		return str < last;
+	}
+	inline BoundedCharacterAbstraction add(size_t c) const {
+		return BoundedCharacterAbstraction{str+c,original,last};
+	}
+	template <typename CharTypeInner> inline bool equal(const CharTypeInner c) const {
+		return exists() && equalFnc(*str,c,c);
+	}
+	inline bool equalToOriginal(const size_t pos, const size_t vec) const {
+		return exists(vec) && equalFnc(*(original+pos),*(str+vec),*(str+vec));
+	}
+	template <typename CharTypeInner> inline bool charIsBetween(const CharTypeInner a, const CharTypeInner b) const {
+		return exists() && (*str >= a) && (*str <= b);
+	}
+	// current character is in Set (see FirstCharacter in regexp.hpp)
+	template <typename Set> inline bool inSet() const {
+		return exists() && CharacterSetLookup<CharType, equalFnc, Set>::check(*str);
+	}
+	// number of characters from Set beginning at current position
+	template <typename Set> inline size_t run() const {
+		return str < last ? CharacterRunScanner<CharType, equalFnc, Set>::length(str, last) : 0;
+	}
+	inline bool isBegin() const {
+		return getPosition() == 0;
+	}
+	inline bool isEnd() const {
+		return !exists();
+	}
+	inline size_t getPosition() const {
+		return str-original;
+	}
+	// returns first position (from pos) which can be begin of match or end of input
+	template <typename Set> inline size_t skip(const size_t pos) const {
+		return exists(pos) ? FirstCharacterScanner<CharType, equalFnc, Set>::find(str+pos, last) - str : pos;
+	}
+	template <typename SetA, typename SetB> static constexpr bool disjoint() {
+		return DisjointSets<CharType, equalFnc, SetA, SetB>::value;
+	}
+	// data built once for compare function of abstraction (Builder::get<CharType, equalFnc>() must return reference to static object)
+	template <typename Builder> static inline const typename Builder::Type & shared() {
+		return Builder::template get<CharType, equalFnc>();
+	}
 };
 
 template <bool (*compare)(const char, const char, const char)> struct StringAbstraction<const char *, const char, compare>: public CharacterAbstraction<char, compare> {
@@ -0,0 +1,267 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014-2015 Hana Dusíková (hanicka@hanicka.net)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef __REGEXP__DFA__HPP__
+#define __REGEXP__DFA__HPP__
+
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace SRX {
+
+	// Thompson NFA over bytes (built from regexp without catches, see NFABuilder in regexp.hpp)
+	struct NFAState
+	{
+		enum class Type: uint8_t { Character, Split, Begin, End, Match };
+		Type type;
+		unsigned int out1;
+		unsigned int out2;
+		std::bitset<256> characters;
+		// index of pattern (for Match states in automaton built from more patterns)
+		unsigned int pattern;
+	};
+
+	struct NFA
+	{
+		std::vector<NFAState> states;
+		unsigned int start{0};
+		// pattern which is currently built
+		unsigned int pattern{0};
+		unsigned int add(NFAState::Type type, unsigned int out1 = 0, unsigned int out2 = 0)
+		{
+			states.push_back(NFAState{type, out1, out2, std::bitset<256>{}, pattern});
+			return static_cast<unsigned int>(states.size() - 1);
+		}
+		unsigned int addCharacter(const bool * table, unsigned int next)
+		{
+			unsigned int id{add(NFAState::Type::Character, next)};
+			for (unsigned int c{0}; c != 256; ++c) states[id].characters[c] = table[c];
+			return id;
+		}
+		unsigned int addMatch()
+		{
+			return add(NFAState::Type::Match);
+		}
+		unsigned int addSplit(unsigned int out1, unsigned int out2)
+		{
+			return add(NFAState::Type::Split, out1, out2);
+		}
+		// state which never matches anything
+		unsigned int addFail()
+		{
+			return add(NFAState::Type::Character);
+		}
+	};
+
+	// DFA for floating search (match can begin anywhere), built with subset construction from NFA
+	struct DFA
+	{
+		static const constexpr unsigned int maxStates{4096};
+		// set of patterns (bit for every pattern index)
+		using Mask = uint64_t;
+
+		std::vector<uint16_t> transitions;
+		// patterns which were found before current character / at the end of input
+		std::vector<Mask> acceptBefore;
+		std::vector<Mask> acceptAtEnd;
+		unsigned int initial{0};
+		unsigned int idle{0};
+		// false if automaton has too many states (regexp must be matched with backtracking)
+		bool valid{false};
+		// idle state never leads to match (every match begins at first position), search can stop there
+		bool anchored{false};
+
+		DFA() = default;
+		explicit DFA(const NFA & nfa)
+		{
+			valid = build(nfa);
+		}
+
+		// returns true if there is a match anywhere in input, positions in idle state are skipped with Set
+		template <typename Set, typename StringAbstraction> inline bool search(const StringAbstraction string) const
+		{
+			unsigned int state{initial};
+			size_t pos{0};
+			return resume<Set>(string, state, pos) || acceptAtEnd[state];
+		}
+		// continues with state from previous piece of input (see MatchStream in regexp.hpp)
+		// returns true when match ends at pos (before character at pos or at end of piece)
+		template <typename Set, typename StringAbstraction> inline bool resume(const StringAbstraction string, unsigned int & state, size_t & pos) const
+		{
+			while (string.exists(pos))
+			{
+				if (acceptBefore[state]) return true;
+				if (state == idle)
+				{
+					if (anchored) return false;
+					pos = string.template skip<Set>(pos);
+					if (!string.exists(pos)) break;
+				}
+				state = transitions[state * 256 + static_cast<unsigned char>(string.str[pos++])];
+			}
+			return acceptBefore[state];
+		}
+		// returns set of all patterns which match, search stops when all of them are found
+		template <typename Set, typename StringAbstraction> inline Mask searchAll(const StringAbstraction string, const Mask all) const
+		{
+			unsigned int state{initial};
+			Mask found{0};
+			size_t pos{0};
+			while (string.exists(pos))
+			{
+				found |= acceptBefore[state];
+				if (found == all) return found;
+				if (state == idle)
+				{
+					if (anchored) break;
+					pos = string.template skip<Set>(pos);
+					if (!string.exists(pos)) break;
+				}
+				state = transitions[state * 256 + static_cast<unsigned char>(string.str[pos++])];
+			}
+			return found | acceptAtEnd[state];
+		}
+	protected:
+		using StateSet = std::vector<unsigned int>;
+
+		// epsilon closure, Begin/End assertions are passable only at begin/end of input
+		static StateSet closure(const NFA & nfa, const StateSet & from, bool atBegin, bool atEnd)
+		{
+			std::vector<bool> visited(nfa.states.size(), false);
+			std::vector<unsigned int> stack(from.begin(), from.end());
+			StateSet result;
+			while (!stack.empty())
+			{
+				unsigned int id{stack.back()};
+				stack.pop_back();
+				if (visited[id]) continue;
+				visited[id] = true;
+				const NFAState & state = nfa.states[id];
+				switch (state.type)
+				{
+					case NFAState::Type::Split:
+						stack.push_back(state.out2);
+						stack.push_back(state.out1);
+						break;
+					case NFAState::Type::Begin:
+						result.push_back(id);
+						if (atBegin) stack.push_back(state.out1);
+						break;
+					case NFAState::Type::End:
+						result.push_back(id);
+						if (atEnd) stack.push_back(state.out1);
+						break;
+					default:
+						result.push_back(id);
+				}
+			}
+			std::sort(result.begin(), result.end());
+			return result;
+		}
+		static Mask acceptedPatterns(const NFA & nfa, const StateSet & set)
+		{
+			Mask result{0};
+			for (unsigned int id: set) if (nfa.states[id].type == NFAState::Type::Match) result |= Mask{1} << nfa.states[id].pattern;
+			return result;
+		}
+		static StateSet merge(StateSet a, const StateSet & b)
+		{
+			a.insert(a.end(), b.begin(), b.end());
+			std::sort(a.begin(), a.end());
+			a.erase(std::unique(a.begin(), a.end()), a.end());
+			return a;
+		}
+		bool build(const NFA & nfa)
+		{
+			// new match can start before every character (restart set), Begin is passable only before first one
+			const StateSet restartAtBegin{closure(nfa, {nfa.start}, true, false)};
+			const StateSet restart{closure(nfa, {nfa.start}, false, false)};
+
+			// DFA state is set of NFA states (without restart set) and flag for first position
+			std::map<std::pair<StateSet, bool>, unsigned int> known;
+			std::vector<std::pair<StateSet, bool>> pending;
+
+			auto get = [&](const StateSet & set, bool first) -> unsigned int {
+				auto it = known.find({set, first});
+				if (it != known.end()) return it->second;
+				unsigned int id{static_cast<unsigned int>(pending.size())};
+				known.insert({{set, first}, id});
+				pending.push_back({set, first});
+				return id;
+			};
+
+			// bytes which are indistinguishable for all NFA states share transitions
+			std::vector<unsigned int> byteClass(256, 0);
+			for (const NFAState & state: nfa.states)
+			{
+				if (state.type != NFAState::Type::Character) continue;
+				std::map<std::pair<unsigned int, bool>, unsigned int> split;
+				for (unsigned int c{0}; c != 256; ++c)
+				{
+					auto it = split.insert({{byteClass[c], state.characters[c]}, static_cast<unsigned int>(split.size())}).first;
+					byteClass[c] = it->second;
+				}
+			}
+
+			initial = get(StateSet{}, true);
+			idle = get(StateSet{}, false);
+
+			for (unsigned int id{0}; id < pending.size(); ++id)
+			{
+				if (pending.size() > maxStates) return false;
+				const StateSet set = pending[id].first;
+				const bool first = pending[id].second;
+				const StateSet current{closure(nfa, merge(set, first ? restartAtBegin : restart), first, false)};
+
+				acceptBefore.push_back(acceptedPatterns(nfa, current));
+				acceptAtEnd.push_back(acceptedPatterns(nfa, closure(nfa, first ? restartAtBegin : set, first, true)));
+
+				transitions.resize((id + 1) * 256);
+				std::map<unsigned int, uint16_t> targets;
+				for (unsigned int c{0}; c != 256; ++c)
+				{
+					auto it = targets.find(byteClass[c]);
+					if (it == targets.end())
+					{
+						StateSet next;
+						for (unsigned int sid: current)
+						{
+							const NFAState & state = nfa.states[sid];
+							if (state.type == NFAState::Type::Character && state.characters[c]) next.push_back(state.out1);
+						}
+						it = targets.insert({byteClass[c], static_cast<uint16_t>(get(closure(nfa, next, false, false), false))}).first;
+					}
+					transitions[id * 256 + c] = it->second;
+				}
+			}
+			if (pending.size() > maxStates) return false;
+			anchored = !acceptBefore[idle] && !acceptAtEnd[idle] && std::all_of(transitions.begin() + idle * 256, transitions.begin() + (idle + 1) * 256, [&](uint16_t target){ return target == idle; });
+			return true;
+		}
+	};
+
+}
+
+#endif
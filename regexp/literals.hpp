@@ -0,0 +1,148 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014-2015 Hana Dusíková (hanicka@hanicka.net)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef __REGEXP__LITERALS__HPP__
+#define __REGEXP__LITERALS__HPP__
+
+#include <bitset>
+#include <map>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace SRX {
+
+	// literal is list of positions, every position is set of bytes accepted there
+	using Literal = std::vector<std::bitset<256>>;
+
+	// literal which is prefix of input: its index (in list of literals) and length
+	struct FoundLiteral
+	{
+		unsigned int index;
+		unsigned int length;
+	};
+
+	// anchored automaton (trie) for set of literals, it finds all literals which are prefix of input in one walk
+	struct LiteralAutomaton
+	{
+		// special states and value for state without accepted literal
+		enum: unsigned int { dead = 0, root = 1, none = ~0u };
+
+		std::vector<unsigned int> byteClass;
+		unsigned int classCount{1};
+		std::vector<unsigned int> transitions;
+		// literal with smallest index which ends in state (or none)
+		std::vector<unsigned int> accepted;
+
+		explicit LiteralAutomaton(const std::vector<Literal> & literals): byteClass(256, 0)
+		{
+			build(literals);
+		}
+
+		// found literals are ordered by length, returns their count
+		template <typename StringAbstraction> inline unsigned int find(const StringAbstraction string, FoundLiteral * found) const
+		{
+			unsigned int count{0};
+			unsigned int state{root};
+			for (size_t pos{0}; ; ++pos)
+			{
+				if (accepted[state] != none) found[count++] = FoundLiteral{accepted[state], static_cast<unsigned int>(pos)};
+				if (!string.exists(pos)) break;
+				state = transitions[state * classCount + byteClass[static_cast<unsigned char>(string.str[pos])]];
+				if (state == dead) break;
+			}
+			return count;
+		}
+	protected:
+		void build(const std::vector<Literal> & literals)
+		{
+			// bytes which are indistinguishable for all positions share transitions
+			for (const Literal & literal: literals)
+			{
+				for (const std::bitset<256> & position: literal)
+				{
+					std::map<std::pair<unsigned int, bool>, unsigned int> split;
+					for (unsigned int c{0}; c != 256; ++c)
+					{
+						auto it = split.insert({{byteClass[c], position[c]}, static_cast<unsigned int>(split.size())}).first;
+						byteClass[c] = it->second;
+					}
+				}
+			}
+			std::vector<unsigned int> representative;
+			for (unsigned int c{0}; c != 256; ++c)
+			{
+				if (byteClass[c] >= representative.size()) representative.resize(byteClass[c] + 1, c);
+			}
+			classCount = static_cast<unsigned int>(representative.size());
+
+			// state is set of literals which are still alive at some depth
+			using State = std::pair<size_t, std::vector<unsigned int>>;
+			std::map<State, unsigned int> known;
+			std::vector<State> pending{State{}, State{}};
+
+			auto get = [&](const State & state) -> unsigned int {
+				if (state.second.empty()) return dead;
+				auto it = known.find(state);
+				if (it != known.end()) return it->second;
+				unsigned int id{static_cast<unsigned int>(pending.size())};
+				known.insert({state, id});
+				pending.push_back(state);
+				return id;
+			};
+
+			pending[root].first = 0;
+			for (unsigned int i{0}; i != literals.size(); ++i) pending[root].second.push_back(i);
+			known.insert({pending[root], root});
+
+			transitions.assign(2 * classCount, dead);
+			accepted.assign(2, none);
+
+			for (unsigned int id{root}; id < pending.size(); ++id)
+			{
+				const State state = pending[id];
+				const size_t depth{state.first};
+				accepted.resize(id + 1, none);
+				for (unsigned int index: state.second)
+				{
+					if (literals[index].size() == depth)
+					{
+						accepted[id] = index;
+						break;
+					}
+				}
+				transitions.resize((id + 1) * classCount, dead);
+				for (unsigned int k{0}; k != classCount; ++k)
+				{
+					State next{depth + 1, {}};
+					for (unsigned int index: state.second)
+					{
+						if (literals[index].size() > depth && literals[index][depth][representative[k]]) next.second.push_back(index);
+					}
+					transitions[id * classCount + k] = get(next);
+				}
+			}
+		}
+	};
+
+}
+
+#endif
@@ -0,0 +1,378 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014-2015 Hana Dusíková (hanicka@hanicka.net)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef __REGEXP__PATTERN__HPP__
+#define __REGEXP__PATTERN__HPP__
+
+#include "regexp.hpp"
+
+// type of regexp written as PCRE pattern, e.g. SRX_REGEXP("^([a-z]+)=(.*)$") (pattern can have at most 256 characters)
+#define SRX_REGEXP(pattern) ::SRX::Pattern<sizeof(pattern) - 1, SRX_PATTERN_256(pattern)>
+
+// string literal as list of characters (padded with NUL characters)
+#define SRX_PATTERN_AT(s, i) ((i) < sizeof(s) ? (s)[(i) < sizeof(s) ? (i) : 0] : '\0')
+#define SRX_PATTERN_16(s, i) SRX_PATTERN_AT(s, i), SRX_PATTERN_AT(s, i+1), SRX_PATTERN_AT(s, i+2), SRX_PATTERN_AT(s, i+3), SRX_PATTERN_AT(s, i+4), SRX_PATTERN_AT(s, i+5), SRX_PATTERN_AT(s, i+6), SRX_PATTERN_AT(s, i+7), SRX_PATTERN_AT(s, i+8), SRX_PATTERN_AT(s, i+9), SRX_PATTERN_AT(s, i+10), SRX_PATTERN_AT(s, i+11), SRX_PATTERN_AT(s, i+12), SRX_PATTERN_AT(s, i+13), SRX_PATTERN_AT(s, i+14), SRX_PATTERN_AT(s, i+15)
+#define SRX_PATTERN_256(s) SRX_PATTERN_16(s, 0), SRX_PATTERN_16(s, 16), SRX_PATTERN_16(s, 32), SRX_PATTERN_16(s, 48), SRX_PATTERN_16(s, 64), SRX_PATTERN_16(s, 80), SRX_PATTERN_16(s, 96), SRX_PATTERN_16(s, 112), SRX_PATTERN_16(s, 128), SRX_PATTERN_16(s, 144), SRX_PATTERN_16(s, 160), SRX_PATTERN_16(s, 176), SRX_PATTERN_16(s, 192), SRX_PATTERN_16(s, 208), SRX_PATTERN_16(s, 224), SRX_PATTERN_16(s, 240)
+
+namespace SRX {
+
+	// compile-time parser of PCRE subset:
+	// literals and escapes (\n \t \r \f \v and punctuation), ., ^, $, [...] and [^...] with ranges, \d \w \s \D \W \S (only positive ones in [...]), (...) catches numbered from 1, (?:...), (?>...),
+	// back-references \1 - \9, |, *, +, ?, {n}, {n,}, {n,m} and possessive *+ ++ ?+ {...}+
+
+	template <char... c> struct PatternChars { };
+	template <typename> struct PatternFalse: std::false_type { };
+
+	// part of pattern: its regexp, rest of pattern and id of next catch
+	template <typename T, typename Rest, unsigned int next> struct PatternParsed
+	{
+		using Type = T;
+		using Remaining = Rest;
+		static const constexpr unsigned int nextId{next};
+	};
+
+	template <typename Input, unsigned int id, typename... Options> struct PatternAlternation;
+	template <typename Input, unsigned int id, typename Parts, typename Pending> struct PatternSequence;
+	template <typename Input, unsigned int id> struct PatternAtom;
+
+	template <char expected, typename Input> struct PatternExpect
+	{
+		static_assert(PatternFalse<Input>::value, "unexpected character in pattern (missing ')', ']' or '}')");
+		using Remaining = PatternChars<>;
+	};
+	template <char expected, char... rest> struct PatternExpect<expected, PatternChars<expected, rest...>>
+	{
+		using Remaining = PatternChars<rest...>;
+	};
+
+	// decimal number in {n,m}
+	template <typename Input, unsigned int value> struct PatternNumberEnd
+	{
+		static const constexpr unsigned int number{value};
+		using Remaining = Input;
+	};
+	template <typename Input, unsigned int value = 0> struct PatternNumber: PatternNumberEnd<Input, value> { };
+	template <char c, char... rest, unsigned int value> struct PatternNumber<PatternChars<c, rest...>, value>: std::conditional<(c >= '0' && c <= '9'), PatternNumber<PatternChars<rest...>, value * 10 + static_cast<unsigned int>(c - '0')>, PatternNumberEnd<PatternChars<c, rest...>, value>>::type { };
+
+	// escaped character (\n, \., ...), character classes and back-references
+	// other escaped letters and \0 (\b, \A, \x41, ...) mean something else in PCRE, so they aren't matched as literals
+	template <char e> struct PatternEscape
+	{
+		static_assert(e == 'n' || e == 't' || e == 'r' || e == 'f' || e == 'v' || !((e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z') || e == '0'), "unsupported escape in pattern");
+		static const constexpr char value{e == 'n' ? '\n' : e == 't' ? '\t' : e == 'r' ? '\r' : e == 'f' ? '\f' : e == 'v' ? '\v' : e};
+		using Bounds = CharacterRange<true, value, value>;
+		using Type = typename std::conditional<(e >= '1' && e <= '9'), ReCatch<static_cast<unsigned int>(e - '0'), lastCatch>, String<value>>::type;
+	};
+	template <> struct PatternEscape<'d'>
+	{
+		using Bounds = CharacterRange<true, '0', '9'>;
+		using Type = Bounds;
+	};
+	template <> struct PatternEscape<'w'>
+	{
+		using Bounds = CharacterRange<true, 'a', 'z', 'A', 'Z', '0', '9', '_', '_'>;
+		using Type = Bounds;
+	};
+	template <> struct PatternEscape<'s'>
+	{
+		using Bounds = CharacterRange<true, ' ', ' ', '\t', '\t', '\n', '\n', '\r', '\r', '\f', '\f', '\v', '\v'>;
+		using Type = Bounds;
+	};
+	// negative classes can't be part of [...]
+	template <> struct PatternEscape<'D'>
+	{
+		using Type = CharacterRange<false, '0', '9'>;
+	};
+	template <> struct PatternEscape<'W'>
+	{
+		using Type = CharacterRange<false, 'a', 'z', 'A', 'Z', '0', '9', '_', '_'>;
+	};
+	template <> struct PatternEscape<'S'>
+	{
+		using Type = CharacterRange<false, ' ', ' ', '\t', '\t', '\n', '\n', '\r', '\r', '\f', '\f', '\v', '\v'>;
+	};
+
+	// [...] collects pairs of bounds
+	template <typename Range, typename Added> struct PatternRangeAdd;
+	template <bool positive, wchar_t... bounds, wchar_t... added> struct PatternRangeAdd<CharacterRange<positive, bounds...>, CharacterRange<true, added...>>
+	{
+		using Type = CharacterRange<positive, bounds..., added...>;
+	};
+
+	template <typename Input, typename Range> struct PatternClass
+	{
+		static_assert(PatternFalse<Input>::value, "missing ']' in pattern");
+		using Type = Range;
+		using Remaining = PatternChars<>;
+	};
+	template <wchar_t first, typename Input, typename Range> struct PatternClassRange;
+	template <char... rest, typename Range> struct PatternClass<PatternChars<']', rest...>, Range>
+	{
+		using Type = Range;
+		using Remaining = PatternChars<rest...>;
+	};
+	template <char e, typename Input, typename Range> struct PatternClassEscape: PatternClassRange<PatternEscape<e>::value, Input, Range>
+	{
+		static_assert(e < '1' || e > '9', "back-reference can't be part of [...] in pattern");
+	};
+	template <typename Input, typename Range> struct PatternClassEscape<'d', Input, Range>: PatternClass<Input, typename PatternRangeAdd<Range, typename PatternEscape<'d'>::Bounds>::Type> { };
+	template <typename Input, typename Range> struct PatternClassEscape<'w', Input, Range>: PatternClass<Input, typename PatternRangeAdd<Range, typename PatternEscape<'w'>::Bounds>::Type> { };
+	template <typename Input, typename Range> struct PatternClassEscape<'s', Input, Range>: PatternClass<Input, typename PatternRangeAdd<Range, typename PatternEscape<'s'>::Bounds>::Type> { };
+	template <typename Input, typename Range> struct PatternClassNegativeEscape: PatternClass<Input, Range>
+	{
+		static_assert(PatternFalse<Input>::value, "negative class can't be part of [...] in pattern");
+	};
+	template <typename Input, typename Range> struct PatternClassEscape<'D', Input, Range>: PatternClassNegativeEscape<Input, Range> { };
+	template <typename Input, typename Range> struct PatternClassEscape<'W', Input, Range>: PatternClassNegativeEscape<Input, Range> { };
+	template <typename Input, typename Range> struct PatternClassEscape<'S', Input, Range>: PatternClassNegativeEscape<Input, Range> { };
+	template <char e, char... rest, typename Range> struct PatternClass<PatternChars<'\\', e, rest...>, Range>: PatternClassEscape<e, PatternChars<rest...>, Range> { };
+	template <char c, char... rest, typename Range> struct PatternClass<PatternChars<c, rest...>, Range>: PatternClassRange<c, PatternChars<rest...>, Range> { };
+
+	template <wchar_t first, typename Input, typename Range> struct PatternClassRange: PatternClass<Input, typename PatternRangeAdd<Range, CharacterRange<true, first, first>>::Type> { };
+	template <wchar_t first, char last, char... rest, typename Range> struct PatternClassRange<first, PatternChars<'-', last, rest...>, Range>: PatternClass<PatternChars<rest...>, typename PatternRangeAdd<Range, CharacterRange<true, first, last>>::Type> { };
+	// [a-] contains a and -
+	template <wchar_t first, char... rest, typename Range> struct PatternClassRange<first, PatternChars<'-', ']', rest...>, Range>: PatternClass<PatternChars<'-', ']', rest...>, typename PatternRangeAdd<Range, CharacterRange<true, first, first>>::Type> { };
+
+	// ']' right after '[' or '[^' is literal ([]a] contains ] and a)
+	template <typename Input, bool positive> struct PatternClassFirst: PatternClass<Input, CharacterRange<positive>> { };
+	template <char... rest, bool positive> struct PatternClassFirst<PatternChars<']', rest...>, positive>: PatternClassRange<']', PatternChars<rest...>, CharacterRange<positive>> { };
+
+	// quantifiers (max = 0 means unbounded when infinite is set, otherwise atom is matched zero times)
+	template <unsigned int min, unsigned int max, bool infinite, typename Atom> struct PatternRepeat
+	{
+		static_assert(infinite || min <= max, "wrong bounds {n,m} in pattern");
+		using Type = typename std::conditional<!infinite && max == 0, Empty, Repeat<min, max, Atom>>::type;
+		using Possessive = typename std::conditional<!infinite && max == 0, Empty, PossessiveRepeat<min, max, Atom>>::type;
+	};
+	template <typename Atom> struct PatternRepeat<0, 1, false, Atom>
+	{
+		using Type = Optional<Atom>;
+		using Possessive = PossessiveRepeat<0, 1, Atom>;
+	};
+
+	template <typename Input, typename Repeated> struct PatternPossessive: PatternParsed<typename Repeated::Type, Input, 0> { };
+	template <char... rest, typename Repeated> struct PatternPossessive<PatternChars<'+', rest...>, Repeated>: PatternParsed<typename Repeated::Possessive, PatternChars<rest...>, 0> { };
+	template <char... rest, typename Repeated> struct PatternPossessive<PatternChars<'?', rest...>, Repeated>
+	{
+		static_assert(PatternFalse<Repeated>::value, "lazy quantifiers aren't supported");
+	};
+
+	template <typename Input, unsigned int min> struct PatternBounds
+	{
+		static_assert(PatternFalse<Input>::value, "wrong bounds {n,m} in pattern");
+		static const constexpr unsigned int max{0};
+		static const constexpr bool infinite{false};
+		using Remaining = PatternChars<>;
+	};
+	template <char... rest, unsigned int min> struct PatternBounds<PatternChars<'}', rest...>, min>
+	{
+		static const constexpr unsigned int max{min};
+		static const constexpr bool infinite{false};
+		using Remaining = PatternChars<rest...>;
+	};
+	template <char... rest, unsigned int min> struct PatternBounds<PatternChars<',', '}', rest...>, min>
+	{
+		static const constexpr unsigned int max{0};
+		static const constexpr bool infinite{true};
+		using Remaining = PatternChars<rest...>;
+	};
+	template <char... rest, unsigned int min> struct PatternBounds<PatternChars<',', rest...>, min>
+	{
+		static const constexpr unsigned int max{PatternNumber<PatternChars<rest...>>::number};
+		static const constexpr bool infinite{false};
+		using Remaining = typename PatternExpect<'}', typename PatternNumber<PatternChars<rest...>>::Remaining>::Remaining;
+	};
+
+	template <typename Input, typename Atom> struct PatternQuantifier: PatternParsed<Atom, Input, 0> { };
+	template <char... rest, typename Atom> struct PatternQuantifier<PatternChars<'*', rest...>, Atom>: PatternPossessive<PatternChars<rest...>, PatternRepeat<0, 0, true, Atom>> { };
+	template <char... rest, typename Atom> struct PatternQuantifier<PatternChars<'+', rest...>, Atom>: PatternPossessive<PatternChars<rest...>, PatternRepeat<1, 0, true, Atom>> { };
+	template <char... rest, typename Atom> struct PatternQuantifier<PatternChars<'?', rest...>, Atom>: PatternPossessive<PatternChars<rest...>, PatternRepeat<0, 1, false, Atom>> { };
+	template <char... rest, typename Atom> struct PatternQuantifier<PatternChars<'{', rest...>, Atom>
+	{
+		using Min = PatternNumber<PatternChars<rest...>>;
+		using Bounds = PatternBounds<typename Min::Remaining, Min::number>;
+		using Parsed = PatternPossessive<typename Bounds::Remaining, PatternRepeat<Min::number, Bounds::max, Bounds::infinite, Atom>>;
+		using Type = typename Parsed::Type;
+		using Remaining = typename Parsed::Remaining;
+	};
+
+	// atoms: literal, escape, class, group
+	template <char c, char... rest, unsigned int id> struct PatternAtom<PatternChars<c, rest...>, id>: PatternParsed<String<c>, PatternChars<rest...>, id>
+	{
+		static_assert(c != '*' && c != '+' && c != '?' && c != '{', "nothing to repeat in pattern");
+	};
+	template <char... rest, unsigned int id> struct PatternAtom<PatternChars<'.', rest...>, id>: PatternParsed<Any, PatternChars<rest...>, id> { };
+	template <char... rest, unsigned int id> struct PatternAtom<PatternChars<'^', rest...>, id>: PatternParsed<Begin, PatternChars<rest...>, id> { };
+	template <char... rest, unsigned int id> struct PatternAtom<PatternChars<'$', rest...>, id>: PatternParsed<End, PatternChars<rest...>, id> { };
+	template <char e, char... rest, unsigned int id> struct PatternAtom<PatternChars<'\\', e, rest...>, id>: PatternParsed<typename PatternEscape<e>::Type, PatternChars<rest...>, id> { };
+	template <char... rest, unsigned int id> struct PatternAtom<PatternChars<'[', rest...>, id>
+	{
+		using Class = PatternClassFirst<PatternChars<rest...>, true>;
+		using Type = typename Class::Type;
+		using Remaining = typename Class::Remaining;
+		static const constexpr unsigned int nextId{id};
+	};
+	template <char... rest, unsigned int id> struct PatternAtom<PatternChars<'[', '^', rest...>, id>
+	{
+		using Class = PatternClassFirst<PatternChars<rest...>, false>;
+		using Type = typename Class::Type;
+		using Remaining = typename Class::Remaining;
+		static const constexpr unsigned int nextId{id};
+	};
+	template <typename Input, unsigned int id, template <typename...> class Wrapper, unsigned int innerId> struct PatternGroup
+	{
+		using Inner = PatternAlternation<Input, innerId>;
+		using Type = Wrapper<typename Inner::Type>;
+		using Remaining = typename PatternExpect<')', typename Inner::Remaining>::Remaining;
+		static const constexpr unsigned int nextId{Inner::nextId};
+	};
+	template <unsigned int id> struct PatternCatch
+	{
+		template <typename... Inner> using Wrapper = CatchContent<id, DynamicMemory, Inner...>;
+	};
+	template <char... rest, unsigned int id> struct PatternAtom<PatternChars<'(', rest...>, id>: PatternGroup<PatternChars<rest...>, id, PatternCatch<id>::template Wrapper, id + 1> { };
+	template <char... rest, unsigned int id> struct PatternAtom<PatternChars<'(', '?', ':', rest...>, id>: PatternGroup<PatternChars<rest...>, id, Sequence, id> { };
+	template <char... rest, unsigned int id> struct PatternAtom<PatternChars<'(', '?', '>', rest...>, id>: PatternGroup<PatternChars<rest...>, id, Atomic, id> { };
+
+	// consecutive literals are joined into one String
+	template <typename Parts, typename Pending> struct PatternFlush;
+	template <typename... Parts> struct PatternFlush<Sequence<Parts...>, String<>>
+	{
+		using Type = Sequence<Parts...>;
+	};
+	template <typename... Parts, wchar_t... pending> struct PatternFlush<Sequence<Parts...>, String<pending...>>
+	{
+		using Type = Sequence<Parts..., String<pending...>>;
+	};
+	template <typename Parts, typename Item> struct PatternPush;
+	template <typename... Parts, typename Item> struct PatternPush<Sequence<Parts...>, Item>
+	{
+		using Type = Sequence<Parts..., Item>;
+	};
+	// literal is kept pending, anything else ends pending literals
+	template <typename Parts, typename Waiting, typename Item> struct PatternJoin
+	{
+		using Done = typename PatternPush<typename PatternFlush<Parts, Waiting>::Type, Item>::Type;
+		using Pending = String<>;
+	};
+	template <typename Parts, wchar_t... waiting, wchar_t code> struct PatternJoin<Parts, String<waiting...>, String<code>>
+	{
+		using Done = Parts;
+		using Pending = String<waiting..., code>;
+	};
+
+	// empty option or group (a|, a()) matches empty string
+	template <typename Parts> struct PatternDone
+	{
+		using Type = Parts;
+	};
+	template <> struct PatternDone<Sequence<>>
+	{
+		using Type = Empty;
+	};
+
+	// sequence ends at end of pattern, | or )
+	template <unsigned int id, typename Parts, typename Pending> struct PatternSequence<PatternChars<>, id, Parts, Pending>: PatternParsed<typename PatternDone<typename PatternFlush<Parts, Pending>::Type>::Type, PatternChars<>, id> { };
+	template <char... rest, unsigned int id, typename Parts, typename Pending> struct PatternSequence<PatternChars<'|', rest...>, id, Parts, Pending>: PatternParsed<typename PatternDone<typename PatternFlush<Parts, Pending>::Type>::Type, PatternChars<'|', rest...>, id> { };
+	template <char... rest, unsigned int id, typename Parts, typename Pending> struct PatternSequence<PatternChars<')', rest...>, id, Parts, Pending>: PatternParsed<typename PatternDone<typename PatternFlush<Parts, Pending>::Type>::Type, PatternChars<')', rest...>, id> { };
+	template <char c, char... rest, unsigned int id, typename Parts, typename Pending> struct PatternSequence<PatternChars<c, rest...>, id, Parts, Pending>
+	{
+		using Atom = PatternAtom<PatternChars<c, rest...>, id>;
+		using Quantified = PatternQuantifier<typename Atom::Remaining, typename Atom::Type>;
+		using Joined = PatternJoin<Parts, Pending, typename Quantified::Type>;
+		using Next = PatternSequence<typename Quantified::Remaining, Atom::nextId, typename Joined::Done, typename Joined::Pending>;
+		using Type = typename Next::Type;
+		using Remaining = typename Next::Remaining;
+		static const constexpr unsigned int nextId{Next::nextId};
+	};
+
+	// options are separated with |
+	template <typename... Options> struct PatternOptions
+	{
+		using Type = Selection<Options...>;
+	};
+	template <typename Option> struct PatternOptions<Option>
+	{
+		using Type = Option;
+	};
+	template <typename Input, unsigned int id, typename... Options> struct PatternNextOption: PatternParsed<typename PatternOptions<Options...>::Type, Input, id> { };
+	template <char... rest, unsigned int id, typename... Options> struct PatternNextOption<PatternChars<'|', rest...>, id, Options...>: PatternAlternation<PatternChars<rest...>, id, Options...> { };
+	template <typename Input, unsigned int id, typename... Options> struct PatternAlternation
+	{
+		using Option = PatternSequence<Input, id, Sequence<>, String<>>;
+		using Next = PatternNextOption<typename Option::Remaining, Option::nextId, Options..., typename Option::Type>;
+		using Type = typename Next::Type;
+		using Remaining = typename Next::Remaining;
+		static const constexpr unsigned int nextId{Next::nextId};
+	};
+
+	// catches outside of cycles have static memory for one catch
+	template <typename T, bool cycle> struct PatternFinal
+	{
+		using Type = T;
+	};
+	template <typename... Inner, bool cycle> struct PatternFinal<Sequence<Inner...>, cycle>
+	{
+		using Type = Sequence<typename PatternFinal<Inner, cycle>::Type...>;
+	};
+	template <typename... Inner, bool cycle> struct PatternFinal<Selection<Inner...>, cycle>
+	{
+		using Type = Selection<typename PatternFinal<Inner, cycle>::Type...>;
+	};
+	template <typename... Inner, bool cycle> struct PatternFinal<Atomic<Inner...>, cycle>
+	{
+		using Type = Atomic<typename PatternFinal<Inner, cycle>::Type...>;
+	};
+	template <unsigned int min, unsigned int max, typename... Inner, bool cycle> struct PatternFinal<Repeat<min, max, Inner...>, cycle>
+	{
+		using Type = Repeat<min, max, typename PatternFinal<Inner, cycle || max != 1>::Type...>;
+	};
+	template <unsigned int min, unsigned int max, typename... Inner, bool cycle> struct PatternFinal<PossessiveRepeat<min, max, Inner...>, cycle>
+	{
+		using Type = PossessiveRepeat<min, max, typename PatternFinal<Inner, cycle || max != 1>::Type...>;
+	};
+	template <unsigned int id, typename... Inner, bool cycle> struct PatternFinal<CatchContent<id, DynamicMemory, Inner...>, cycle>
+	{
+		using Type = CatchContent<id, typename std::conditional<cycle, DynamicMemory, OneMemory>::type, typename PatternFinal<Inner, cycle>::Type...>;
+	};
+
+	template <char... c> struct PatternParser
+	{
+		using Parsed = PatternAlternation<PatternChars<c...>, 1>;
+		static_assert(std::is_same<typename Parsed::Remaining, PatternChars<>>::value, "unbalanced ')' in pattern");
+		using Type = RegularExpression<typename PatternFinal<typename Parsed::Type, false>::Type>;
+	};
+
+	// first length characters of padded string literal
+	template <size_t length, typename Input, char... taken> struct PatternTake
+	{
+		static_assert(PatternFalse<Input>::value, "pattern is too long");
+		using Type = void;
+	};
+	template <size_t length, char c, char... rest, char... taken> struct PatternTake<length, PatternChars<c, rest...>, taken...>: PatternTake<length - 1, PatternChars<rest...>, taken..., c> { };
+	template <char c, char... rest, char... taken> struct PatternTake<0, PatternChars<c, rest...>, taken...>: PatternParser<taken...> { };
+	template <char... taken> struct PatternTake<0, PatternChars<>, taken...>: PatternParser<taken...> { };
+
+	template <size_t length, char... c> using Pattern = typename PatternTake<length, PatternChars<c...>>::Type;
+
+}
+
+#endif
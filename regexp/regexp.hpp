@@ -24,10 +24,20 @@
 
 #include <string>
 #include <vector>
+#include <deque>
 #include <cstddef>
 #include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include <iostream>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
 
 //#define DEBUG	
 	
@@ -47,6 +57,8 @@
 //}
 
 #include "abstraction.hpp"
+#include "dfa.hpp"
+#include "literals.hpp"
 
 namespace SRX {
 	
@@ -64,15 +76,24 @@ namespace SRX {
 	template <unsigned int min, unsigned int max, typename... Inner> struct XRepeat; // a{min;max}
 	template <typename... Inner> using Plus = Repeat<1,0,Inner...>; // (abc)+
 	template <typename... Inner> using Star = Repeat<0,0,Inner...>; // (abc)*
+	template <unsigned int min, unsigned int max, typename... Inner> struct PossessiveRepeat; // a{min;max}+
+	template <typename... Inner> using PossessivePlus = PossessiveRepeat<1,0,Inner...>; // (abc)++
+	template <typename... Inner> using PossessiveStar = PossessiveRepeat<0,0,Inner...>; // (abc)*+
+	template <typename... Inner> struct Atomic; // (?>abc)
 	template <typename... Inner> using Optional = Selection<Sequence<Inner...>,Empty>; // a?
 	template <unsigned int id, typename MemoryType, typename... Inner> struct CatchContent; // catching content of (...)
 	template <unsigned int baseid, unsigned int catchid = 0> struct ReCatch; // ([a-z]) \1
 	template <unsigned int baseid, unsigned int catchid = 0> struct ReCatchReverse; // ([a-z]) \1
 	template <typename... Definition> struct RegularExpression; 
+	template <typename Regexp> struct MatchResults; // catches and identifiers from const matching
+	template <typename... Patterns> struct PatternSet; // which of more regexps match
+	template <typename T> struct FirstCharacter; // characters which can begin match
+	template <typename T> struct AnchoredAtBegin; // match can begin only at first position
 	
 	// MemoryTypes for CatchContent
 	template <size_t size> struct StaticMemory;
 	struct DynamicMemory;
+	struct ArenaMemory;
 	using OneMemory = StaticMemory<1>;
 	
 	// identifier
@@ -91,6 +112,7 @@ namespace SRX {
 	template <unsigned int id, typename... Inner> using OneCatch = CatchContent<id, OneMemory, Inner...>;
 	template <unsigned int id, size_t size, typename... Inner> using StaticCatch = CatchContent<id, StaticMemory<size>, Inner...>;
 	template <unsigned int id, typename... Inner> using DynamicCatch = CatchContent<id, DynamicMemory, Inner...>;
+	template <unsigned int id, typename... Inner> using ArenaCatch = CatchContent<id, ArenaMemory, Inner...>;
 	template <wchar_t a, wchar_t b, wchar_t... rest> using CRange = CharacterRange<true, a, b, rest...>;
 	template <wchar_t... codes> using Str = String<codes...>;
 	template <unsigned int key, unsigned int value> using Id = Identifier<key,value>;
@@ -101,13 +123,21 @@ namespace SRX {
 	
 	
 	template <typename CharType> using CompareFnc = bool (*)(const CharType, const CharType, const CharType);
+	template <typename Regexp, CompareFnc<char> compare = charactersAreEqual<char>> struct MatchStream; // matching of input in pieces
+	template <typename Regexp, CompareFnc<char> compare = charactersAreEqual<char>> struct MatchIterator; // successive matches in input
+	template <typename Regexp, CompareFnc<char> compare = charactersAreEqual<char>> struct MatchRange;
 	
 	// implementation:
-	template <typename T> struct Reference
+	// continuation: object with position of its node in pattern (mark has position of its catch)
+	template <typename T, unsigned int position = 0> struct Reference
 	{
 		T & target;
 		inline Reference(T & ltarget): target(ltarget) { }
 		inline T & getRef() { return target; }
+		template <typename StringAbstraction, typename Root, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Right... right)
+		{
+			return target.template match<position>(string, move, deep, root, right...);
+		}
 	};
 	
 	struct CatchReturn;
@@ -116,7 +146,7 @@ namespace SRX {
 	// it must be always used as last item of call-chain
 	struct Closure
 	{
-		template <typename StringAbstraction, typename Root, typename... Right> inline bool match(const StringAbstraction, size_t &, unsigned int, Root &, Right...)
+		template <unsigned int, typename StringAbstraction, typename Root, typename... Right> inline bool match(const StringAbstraction, size_t &, unsigned int, Root &, Right...)
 		{
 			return true;
 		}
@@ -131,1059 +161,3261 @@ namespace SRX {
 		}
 	};
 	
-	// Memory for all right context
-	
-	template <typename T> struct CheckMemory
+	// continuations of one cycle in Repeat::searchMatch: every end of cycle is collected (all ways are tried) or cycle must end at given position
+	struct CycleEnds
 	{
-		static const constexpr bool have = false;
+		std::vector<size_t> & ends;
+		size_t first;
+		template <unsigned int, typename StringAbstraction, typename Root, typename... Right> inline bool match(const StringAbstraction string, size_t &, unsigned int, Root &, Right...)
+		{
+			if (std::find(ends.begin() + static_cast<ptrdiff_t>(first), ends.end(), string.getPosition()) == ends.end()) ends.push_back(string.getPosition());
+			return false;
+		}
 	};
 	
-	template <typename T> struct CheckMemory<Reference<T>>
+	struct CycleEnd
 	{
-		static const constexpr bool have = CheckMemory<T>::have;
+		size_t end;
+		template <unsigned int, typename StringAbstraction, typename Root, typename... Right> inline bool match(const StringAbstraction string, size_t &, unsigned int, Root &, Right...)
+		{
+			return string.getPosition() == end;
+		}
 	};
 	
-	template <typename... Rest> struct AllRightContext;
-	
-	template <> struct AllRightContext<Reference<Closure>>
-	{
-		AllRightContext(Reference<Closure>) { }
-		void remember(Reference<Closure>) { }
-		void restore(Reference<Closure>) { }
-		static const constexpr bool haveMemory{false};
-		static void visualize(Reference<Closure>) { }
-		void visualizeMe() const { }
-	};
+	// bounded backtracking: every part is tried with its continuation at most once at every position (failures are remembered) and number of tries can be limited
+	enum class MatchStatus { NoMatch, Match, BudgetExceeded };
 	
-	template <typename T, typename... Rest> struct AllRightContext<Reference<T>, Rest...>
+	struct Backtracking
 	{
-		T objCopy;
-		AllRightContext<Rest...> rest;
-		AllRightContext(Reference<T> ref, Rest... irest): objCopy{ref.getRef()}, rest{irest...} { }
-		void remember(Reference<T> ref, Rest... irest)
-		{
-			if (haveMemory || true)
+		size_t budget{0}; // maximal number of tries (0 = unlimited)
+		bool memoize{true};
+		size_t steps{0};
+		bool exceeded{false};
+		Backtracking() = default;
+		explicit Backtracking(size_t lbudget, bool lmemoize = true): budget{lbudget}, memoize{lmemoize} { }
+		inline void prepare(bool allowed)
+		{
+			steps = 0;
+			furthest = 0;
+			exceeded = false;
+			active = memoize && allowed;
+			for (auto & row: failures) std::fill(row.begin(), row.end(), 0);
+			std::fill(runs.begin(), runs.end(), std::pair<size_t, size_t>{0, 0});
+		}
+		// false when try is known to fail (or budget is exceeded)
+		inline bool enter(unsigned int site, size_t pos)
+		{
+			if (exceeded) return false;
+			if (++steps > budget && budget)
 			{
-				objCopy = std::move(ref.getRef());
-				rest.remember(irest...);
+				exceeded = true;
+				return false;
 			}
+			return !failed(site, pos);
+		}
+		inline bool failed(unsigned int site, size_t pos) const
+		{
+			return active && site < failures.size() && (pos >> 6) < failures[site].size() && (failures[site][pos >> 6] & (uint64_t{1} << (pos & 63)));
+		}
+		inline void fail(unsigned int site, size_t pos)
+		{
+			if (!active || exceeded) return;
+			if (pos > furthest) furthest = pos;
+			if (site >= failures.size()) failures.resize(site + 1);
+			if ((pos >> 6) >= failures[site].size()) failures[site].resize((pos >> 6) + 1, 0);
+			failures[site][pos >> 6] |= uint64_t{1} << (pos & 63);
+		}
+		// scanned characters are counted as tries (scanning must not be cheaper than backtracking)
+		inline void charge(size_t bytes)
+		{
+			steps += bytes;
+			if (budget && steps > budget) exceeded = true;
+		}
+		// last run of characters found by cycle [begin, end), it's valid for whole match (input doesn't change)
+		inline std::pair<size_t, size_t> & run(unsigned int site)
+		{
+			if (site >= runs.size()) runs.resize(site + 1, std::pair<size_t, size_t>{0, 0});
+			return runs[site];
 		}
-		void restore(Reference<T> ref, Rest... irest)
+		// failures are remembered only for parts tried with same continuation, others are tried without them (see Repeat::searchMatch)
+		inline bool suspend()
 		{
-			if (haveMemory || true)
+			const bool memoized{active};
+			active = false;
+			return memoized;
+		}
+		inline void resume(bool memoized)
+		{
+			active = memoized;
+		}
+		// failures of sites [first, last] at positions [from, to] aren't valid anymore
+		inline void forget(unsigned int first, unsigned int last, size_t from, size_t to)
+		{
+			if (!active) return;
+			for (unsigned int site{first}; site <= last && site < failures.size(); ++site)
 			{
-				ref.getRef() = std::move(objCopy);
-				rest.restore(irest...);
+				for (size_t pos{from}; pos <= to && (pos >> 6) < failures[site].size(); ++pos) failures[site][pos >> 6] &= ~(uint64_t{1} << (pos & 63));
 			}
-		}	
-		static const constexpr bool haveMemory{CheckMemory<T>::have || AllRightContext<Rest...>::haveMemory};
-		void visualizeMe() const
+		}
+		// positions (from begin of input) which unbounded cycles went through
+		std::vector<std::pair<size_t, size_t>> visited;
+		// last position where failure was remembered
+		size_t furthest{0};
+	protected:
+		bool active{false};
+		std::vector<std::vector<uint64_t>> failures;
+		std::vector<std::pair<size_t, size_t>> runs;
+	};
+	
+	// try of node with its continuation (or just of continuation after node) identified with position of node
+	template <unsigned int node, bool continuation = false> struct Memo
+	{
+		static const constexpr unsigned int site{2 * node + (continuation ? 1 : 0)};
+		template <typename StringAbstraction, typename Root, typename Try> static inline bool match(const StringAbstraction string, Root & root, Try && attempt)
 		{
-			objCopy.visualize();
-			rest.visualizeMe();
+			if (!root.control) return attempt();
+			if (!root.control->enter(site, string.getPosition())) return false;
+			if (attempt()) return true;
+			root.control->fail(site, string.getPosition());
+			return false;
 		}
-		static void visualize(Reference<T> ref, Rest... irest)
+		// unbounded cycle which failed would fail also from every position it went through (it repeats same inner parts there)
+		template <typename StringAbstraction, typename Root, typename Try> static inline bool cycle(const StringAbstraction string, Root & root, Try && attempt)
 		{
-			ref.getRef().visualize();
-			AllRightContext<Rest...>::visualize(irest...);
+			Backtracking & control = *root.control;
+			if (!control.enter(site, string.getPosition())) return false;
+			const size_t base{control.visited.size()};
+			const bool matched{attempt()};
+			if (!matched)
+			{
+				control.fail(site, string.getPosition());
+				for (size_t i{base}; i != control.visited.size(); ++i)
+				{
+					for (size_t pos{control.visited[i].first}; pos <= control.visited[i].second; ++pos) control.fail(site, pos);
+				}
+			}
+			control.visited.resize(base);
+			return matched;
 		}
 	};
 	
+	// Memory for all right context
 	
-	template <typename T> inline Reference<T> makeRef(T & target)
+	template <typename T> struct CheckMemory
 	{
-		return Reference<T>(target);
-	}
+		static const constexpr bool have = false;
+	};
 	
-	// pair representing "catched" content from input
-	struct Catch
+	template <typename T, unsigned int position> struct CheckMemory<Reference<T, position>>
 	{
-		uint32_t begin;
-		uint32_t length;
+		static const constexpr bool have = CheckMemory<T>::have;
 	};
 	
-	// object which represent all of "catched" pairs, support for range-based FOR
-	struct CatchReturn {
-	protected:
-		const Catch * vdata;
-		size_t vsize;
-	public:
-		size_t size() const {
-			return vsize;
-		}
-		const Catch * data() const {
-			return vdata;
-		}
-		CatchReturn(): vdata{nullptr}, vsize{0} { }
-		CatchReturn(const Catch * ldata, size_t lsize): vdata{ldata}, vsize{lsize} { }
-		const Catch * get(const size_t id) {
-			if (id < vsize) return &vdata[id];
-			else return nullptr;
-		}
-		const Catch * begin() const {
-			return vdata;
-		}
-		const Catch * end() const {
-			return (vdata + vsize);
-		}
-		const Catch operator[](unsigned int id)
-		{
-			if (id < vsize) return vdata[id];
-			else return Catch{0,0};
-		}
+	// catches, marks and identifiers are only objects with state (which must be restored after backtracking)
+	template <unsigned int id, typename MemoryType> struct XMark;
+	template <unsigned int part, typename... Inner> struct Debug;
+	template <typename... Inner> struct Eat;
+	
+	template <unsigned int id, typename MemoryType, typename... Inner> struct CheckMemory<CatchContent<id, MemoryType, Inner...>>
+	{
+		static const constexpr bool have = true;
 	};
 	
-	template <unsigned int id, typename T, typename... Tx> inline bool getCatchFromSubrexpHelper(CatchReturn & catches, T & from, Tx &... next)
+	template <unsigned int id, typename MemoryType> struct CheckMemory<XMark<id, MemoryType>>
 	{
-		if (!from.template getCatch<id>(catches))
-		{
-			return getCatchFromSubrexpHelper(catches, next...);
-		}
-		else
-		{
-			return true;
-		}
-	}
+		static const constexpr bool have = true;
+	};
 	
-	template <unsigned int id, typename T> inline bool getCatchFromSubrexpHelper(CatchReturn & catches, T & from)
+	template <unsigned int key, unsigned int value> struct CheckMemory<Identifier<key, value>>
 	{
-		return from.template getCatch<id>(catches);
-	}
+		static const constexpr bool have = true;
+	};
 	
-	template <unsigned int id, typename T, typename... Tx> inline CatchReturn getCatchFromSubrexp(T & from, Tx &... next)
+	template <typename... Parts> struct CheckMemory<Sequence<Parts...>>
 	{
-		CatchReturn catches;
-		getCatchFromSubrexpHelper<id>(catches, from, next...);
-		return catches;
-	}
+		static const constexpr bool have = false;
+	};
 	
-	// static-allocated memory which contains "catched" pairs
+	template <typename First, typename... Rest> struct CheckMemory<Sequence<First, Rest...>>
+	{
+		static const constexpr bool have = CheckMemory<First>::have || CheckMemory<Sequence<Rest...>>::have;
+	};
 	
-	template <size_t size> struct StaticMemory
+	template <typename... Options> struct CheckMemory<Selection<Options...>>
 	{
-	protected:
-		uint32_t count{0};
-		Catch data[size];
-	public:
-		inline void reset()
+		static const constexpr bool have = CheckMemory<Sequence<Options...>>::have;
+	};
+	
+	template <unsigned int min, unsigned int max, typename... Inner> struct CheckMemory<Repeat<min, max, Inner...>>
+	{
+		static const constexpr bool have = CheckMemory<Sequence<Inner...>>::have;
+	};
+	
+	template <unsigned int min, unsigned int max, typename... Inner> struct CheckMemory<PossessiveRepeat<min, max, Inner...>>
+	{
+		static const constexpr bool have = CheckMemory<Sequence<Inner...>>::have;
+	};
+	
+	template <typename... Inner> struct CheckMemory<Atomic<Inner...>>
+	{
+		static const constexpr bool have = CheckMemory<Sequence<Inner...>>::have;
+	};
+	
+	template <unsigned int part, typename... Inner> struct CheckMemory<Debug<part, Inner...>>
+	{
+		static const constexpr bool have = CheckMemory<Sequence<Inner...>>::have;
+	};
+	
+	// right context which can be tried again after failed try without restoring (marks are overwritten by successful try)
+	template <typename... T> struct RestartableRight
+	{
+		static const constexpr bool value = true;
+	};
+	
+	template <typename T, typename... Rest> struct RestartableRight<T, Rest...>
+	{
+		static const constexpr bool value = RestartableRight<T>::value && RestartableRight<Rest...>::value;
+	};
+	
+	template <typename T> struct RestartableRight<T>
+	{
+		static const constexpr bool value = !CheckMemory<T>::have;
+	};
+	
+	template <typename T, unsigned int position> struct RestartableRight<Reference<T, position>>: RestartableRight<T> { };
+	
+	template <unsigned int id, typename MemoryType> struct RestartableRight<XMark<id, MemoryType>>
+	{
+		static const constexpr bool value = true;
+	};
+	
+	// regexp part which matches exactly one character from set
+	template <typename T> struct SingleCharacter
+	{
+		static const constexpr bool value = false;
+	};
+	
+	template <bool positive, wchar_t... codes> struct SingleCharacter<CharacterClass<positive, codes...>>
+	{
+		static const constexpr bool value = true;
+	};
+	
+	template <bool positive, wchar_t... bounds> struct SingleCharacter<CharacterRange<positive, bounds...>>
+	{
+		static const constexpr bool value = true;
+	};
+	
+	// part followed by something which begins with characters of Follow, where at most one way of part can match from every position
+	// (then cycle over it doesn't need other ways of its cycles, disjoint characters are known only for one-byte characters)
+	template <typename StringAbstraction, typename T, typename Follow> struct OneWay: std::false_type { };
+	template <typename StringAbstraction, typename Follow> struct OneWay<StringAbstraction, Begin, Follow>: std::true_type { };
+	template <typename StringAbstraction, typename Follow> struct OneWay<StringAbstraction, End, Follow>: std::true_type { };
+	template <typename StringAbstraction, wchar_t... codes, typename Follow> struct OneWay<StringAbstraction, String<codes...>, Follow>: std::true_type { };
+	template <typename StringAbstraction, bool positive, wchar_t... codes, typename Follow> struct OneWay<StringAbstraction, CharacterClass<positive, codes...>, Follow>: std::true_type { };
+	template <typename StringAbstraction, bool positive, wchar_t... bounds, typename Follow> struct OneWay<StringAbstraction, CharacterRange<positive, bounds...>, Follow>: std::true_type { };
+	template <typename StringAbstraction, unsigned int key, unsigned int value, typename Follow> struct OneWay<StringAbstraction, Identifier<key, value>, Follow>: std::true_type { };
+	template <typename StringAbstraction, unsigned int baseid, unsigned int catchid, typename Follow> struct OneWay<StringAbstraction, ReCatch<baseid, catchid>, Follow>: std::true_type { };
+	template <typename StringAbstraction, unsigned int baseid, unsigned int catchid, typename Follow> struct OneWay<StringAbstraction, ReCatchReverse<baseid, catchid>, Follow>: std::true_type { };
+	// only first way is used
+	template <typename StringAbstraction, typename... Inner, typename Follow> struct OneWay<StringAbstraction, Atomic<Inner...>, Follow>: std::true_type { };
+	template <typename StringAbstraction, unsigned int min, unsigned int max, typename... Inner, typename Follow> struct OneWay<StringAbstraction, PossessiveRepeat<min, max, Inner...>, Follow>: std::true_type { };
+	template <typename StringAbstraction, typename Follow> struct OneWay<StringAbstraction, Sequence<>, Follow>: std::true_type { };
+	template <typename StringAbstraction, typename First, typename Follow> struct OneWay<StringAbstraction, Sequence<First>, Follow>: OneWay<StringAbstraction, First, Follow> { };
+	template <typename StringAbstraction, typename First, typename Second, typename... Rest, typename Follow> struct OneWay<StringAbstraction, Sequence<First, Second, Rest...>, Follow>: std::integral_constant<bool, OneWay<StringAbstraction, First, Sequence<Second, Rest..., Follow>>::value && OneWay<StringAbstraction, Sequence<Second, Rest...>, Follow>::value> { };
+	template <typename StringAbstraction, typename Follow> struct OneWay<StringAbstraction, Selection<>, Follow>: std::true_type { };
+	template <typename StringAbstraction, typename Option, typename Follow> struct OneWay<StringAbstraction, Selection<Option>, Follow>: OneWay<StringAbstraction, Option, Follow> { };
+	template <typename StringAbstraction, typename FirstOption, typename SecondOption, typename... Options, typename Follow> struct OneWay<StringAbstraction, Selection<FirstOption, SecondOption, Options...>, Follow>: std::integral_constant<bool, OneWay<StringAbstraction, FirstOption, Follow>::value && OneWay<StringAbstraction, Selection<SecondOption, Options...>, Follow>::value && !FirstCharacter<FirstOption>::nullable && !FirstCharacter<Selection<SecondOption, Options...>>::nullable && StringAbstraction::template disjoint<FirstCharacter<FirstOption>, FirstCharacter<Selection<SecondOption, Options...>>>()> { };
+	template <typename StringAbstraction, unsigned int id, typename MemoryType, typename... Inner, typename Follow> struct OneWay<StringAbstraction, CatchContent<id, MemoryType, Inner...>, Follow>: OneWay<StringAbstraction, Sequence<Inner...>, Follow> { };
+	template <typename StringAbstraction, unsigned int part, typename... Inner, typename Follow> struct OneWay<StringAbstraction, Debug<part, Inner...>, Follow>: OneWay<StringAbstraction, Sequence<Inner...>, Follow> { };
+	// cycle with fixed count, or cycle which can't continue where its follower begins
+	template <typename StringAbstraction, unsigned int min, unsigned int max, typename... Inner, typename Follow> struct OneWay<StringAbstraction, Repeat<min, max, Inner...>, Follow>: std::integral_constant<bool, OneWay<StringAbstraction, Sequence<Inner...>, Selection<Sequence<Inner...>, Follow>>::value && ((min == max && max) || (!FirstCharacter<Sequence<Inner...>>::nullable && !FirstCharacter<Follow>::nullable && StringAbstraction::template disjoint<FirstCharacter<Sequence<Inner...>>, FirstCharacter<Follow>>()))> { };
+	
+	// numbering of nodes: every node has index in preorder walk of type tree of pattern (known at compile time)
+	// position is passed to match() of node (and kept in reference to continuation), so equal nodes at different places have own index
+	template <typename... Nodes> struct NodeList { };
+	
+	template <typename T> struct Children
+	{
+		using Type = NodeList<>;
+	};
+	
+	// node with more inner parts is matched as node over sequence of them (so sequence is node too)
+	template <typename... Inner> struct InnerNodes
+	{
+		using Type = NodeList<Sequence<Inner...>>;
+	};
+	
+	template <typename Inner> struct InnerNodes<Inner>
+	{
+		using Type = NodeList<Inner>;
+	};
+	
+	template <typename... Parts> struct Children<Sequence<Parts...>>
+	{
+		using Type = NodeList<Parts...>;
+	};
+	
+	template <typename... Options> struct Children<Selection<Options...>>
+	{
+		using Type = NodeList<Options...>;
+	};
+	
+	template <typename... Inner> struct Children<Atomic<Inner...>>
+	{
+		using Type = NodeList<Inner...>;
+	};
+	
+	template <typename... Inner> struct Children<Eat<Inner...>>
+	{
+		using Type = NodeList<Inner...>;
+	};
+	
+	template <unsigned int part, typename... Inner> struct Children<Debug<part, Inner...>>
+	{
+		using Type = NodeList<Inner...>;
+	};
+	
+	template <unsigned int min, unsigned int max, typename... Inner> struct Children<Repeat<min, max, Inner...>>: InnerNodes<Inner...> { };
+	template <unsigned int min, unsigned int max, typename... Inner> struct Children<PossessiveRepeat<min, max, Inner...>>: InnerNodes<Inner...> { };
+	template <unsigned int id, typename MemoryType, typename... Inner> struct Children<CatchContent<id, MemoryType, Inner...>>: InnerNodes<Inner...> { };
+	
+	template <typename T> struct NodeCount;
+	
+	template <typename List> struct NodeListCount
+	{
+		static const constexpr unsigned int value = 0;
+	};
+	
+	template <typename First, typename... Rest> struct NodeListCount<NodeList<First, Rest...>>
+	{
+		static const constexpr unsigned int value = NodeCount<First>::value + NodeListCount<NodeList<Rest...>>::value;
+	};
+	
+	template <typename T> struct NodeCount
+	{
+		static const constexpr unsigned int value = 1 + NodeListCount<typename Children<T>::Type>::value;
+	};
+	
+	// node with given index in tree
+	template <typename Tree, unsigned int position> struct NodeAt;
+	
+	template <typename List, unsigned int position> struct NodeListAt;
+	
+	template <typename First, typename... Rest, unsigned int position> struct NodeListAt<NodeList<First, Rest...>, position>: std::conditional<(position < NodeCount<First>::value), NodeAt<First, position>, NodeListAt<NodeList<Rest...>, position - NodeCount<First>::value>>::type { };
+	
+	template <typename Tree> struct NodeRoot
+	{
+		using Type = Tree;
+	};
+	
+	template <typename Tree, unsigned int position> struct NodeAt: std::conditional<(position == 0), NodeRoot<Tree>, NodeListAt<typename Children<Tree>::Type, position - 1>>::type { };
+	
+	// catch is identified with its id (marks don't know whole CatchContent)
+	template <unsigned int id> struct CatchNode;
+	
+	// profiling (only with SRX_PROFILE): instrumented nodes count entries, successes, backtracks (given back tries) and bytes consumed by node with its continuation
+	struct NodeProfile
+	{
+		std::string name;
+		unsigned long long entries{0};
+		unsigned long long successes{0};
+		unsigned long long backtracks{0};
+		unsigned long long bytes{0};
+	};
+	
+	template <typename T> struct NodeName;
+	
+	// counters of all instrumented nodes in regexp (or results) indexed with position of node
+	struct Profile
+	{
+		std::vector<NodeProfile> nodes;
+		template <typename Node> inline NodeProfile & get(unsigned int id, unsigned int count)
 		{
-			count = 0;
+			if (id >= nodes.size()) nodes.resize(count);
+			if (nodes[id].name.empty()) nodes[id].name = NodeName<Node>::get();
+			return nodes[id];
 		}
-		StaticMemory() = default;
-		StaticMemory(const StaticMemory & right) = default;
-		StaticMemory & operator=(const StaticMemory & right) = default;
-		StaticMemory & operator=(StaticMemory && right)
+		void reset()
 		{
-			count = right.count;
-			for (unsigned int i{0}; i != count; ++i)
-			{
-				data[i] = right.data[i];
-			}
-			right.count = 0;
-			return *this;
+			nodes.clear();
 		}
-		void set(unsigned int addr, Catch content)
+		std::ostream & toJSON(std::ostream & str) const
 		{
-			if (addr < size) data[addr] = content;
+			str << "{\"nodes\":[";
+			bool first{true};
+			for (size_t id{0}; id != nodes.size(); ++id)
+			{
+				const NodeProfile & node = nodes[id];
+				if (node.name.empty()) continue;
+				if (!first) str << ',';
+				first = false;
+				str << "{\"id\":" << id << ",\"node\":\"" << node.name << "\",\"entries\":" << node.entries << ",\"successes\":" << node.successes << ",\"backtracks\":" << node.backtracks << ",\"bytes\":" << node.bytes << '}';
+			}
+			return str << "]}";
 		}
-		int add(Catch content)
+	};
+	
+	template <typename Node, unsigned int position> struct Probe
+	{
+		template <typename Root> static inline bool leave(Root & root, bool matched, size_t bytes)
 		{
-			if (count < size) 
+		#ifdef SRX_PROFILE
+			NodeProfile & node = root.profile.template get<Node>(position, NodeCount<Root>::value);
+			node.entries++;
+			if (matched)
 			{
-				unsigned int ret = count++;
-				data[ret] = content;
-				return ret;
+				node.successes++;
+				node.bytes += bytes;
 			}
-			return -1;
+		#else
+			(void)root;
+			(void)bytes;
+		#endif
+			return matched;
 		}
-		size_t getCount() const
+		template <typename Root> static inline void backtrack(Root & root)
 		{
-			return count;
+		#ifdef SRX_PROFILE
+			root.profile.template get<Node>(position, NodeCount<Root>::value).backtracks++;
+		#else
+			(void)root;
+		#endif
 		}
-		CatchReturn getCatches() const
+	};
+	
+	template <unsigned int min, unsigned int max, typename... Inner> struct NodeName<Repeat<min, max, Inner...>>
+	{
+		static std::string get()
 		{
-			return CatchReturn{data, count};
+			return "Repeat<" + std::to_string(min) + "," + std::to_string(max) + ">";
 		}
 	};
 	
-	// dynamic-allocated memory (based on std::vector) which contains "catched" pairs
-	
-	struct DynamicMemory
+	template <unsigned int min, unsigned int max, typename... Inner> struct NodeName<PossessiveRepeat<min, max, Inner...>>
 	{
-	protected:
-		std::vector<Catch> data;
-	public:
-		inline void reset()
+		static std::string get()
 		{
-			data.resize(0);
+			return "PossessiveRepeat<" + std::to_string(min) + "," + std::to_string(max) + ">";
 		}
-		void set(unsigned int addr, Catch content)
+	};
+	
+	template <typename... Inner> struct NodeName<Atomic<Inner...>>
+	{
+		static std::string get()
 		{
-			if (addr < getCount()) data[addr] = content;
-		}
-		int add(Catch content)
-		{
-			data.push_back(content);
-			return data.size()-1;
+			return "Atomic";
 		}
-		size_t getCount() const
+	};
+	
+	template <typename... Options> struct NodeName<Selection<Options...>>
+	{
+		static std::string get()
 		{
-			return data.size();
+			return "Selection<" + std::to_string(sizeof...(Options)) + ">";
 		}
-		CatchReturn getCatches() const
+	};
+	
+	template <unsigned int id> struct NodeName<CatchNode<id>>
+	{
+		static std::string get()
 		{
-			return CatchReturn{data.data(), getCount()};
+			return "CatchContent<" + std::to_string(id) + ">";
 		}
 	};
 	
-	// struct which represents Begin ^ regexp sign (matching for first-position)
-	struct Begin
+	template <unsigned int baseid, unsigned int catchid> struct NodeName<ReCatch<baseid, catchid>>
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		static std::string get()
 		{
-			if (string.isBegin())
-			{
-				if (nright.getRef().match(string, move, deep, root, right...))
-				{
-					return true;
-				}
-			}
-			return false;
+			return "ReCatch<" + std::to_string(baseid) + "," + std::to_string(catchid) + ">";
 		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+	};
+	
+	template <unsigned int baseid, unsigned int catchid> struct NodeName<ReCatchReverse<baseid, catchid>>
+	{
+		static std::string get()
 		{
-			return false;
+			return "ReCatchReverse<" + std::to_string(baseid) + "," + std::to_string(catchid) + ">";
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+	};
+	
+	template <typename... Inner> struct NodeName<Eat<Inner...>>
+	{
+		static std::string get()
 		{
-			return 0;
+			return "Eat";
 		}
 	};
 	
-	// struct which represent End $ regexp sign (matching for end-of-input)
-	struct End
+	// back-reference depends on catches (not just on position), so regexp with it isn't memoized
+	template <typename T> struct HasBackReference
+	{
+		static const constexpr bool value = false;
+	};
+	
+	template <unsigned int baseid, unsigned int catchid> struct HasBackReference<ReCatch<baseid, catchid>>
+	{
+		static const constexpr bool value = true;
+	};
+	
+	template <unsigned int baseid, unsigned int catchid> struct HasBackReference<ReCatchReverse<baseid, catchid>>
+	{
+		static const constexpr bool value = true;
+	};
+	
+	template <typename... Parts> struct HasBackReference<Sequence<Parts...>>
+	{
+		static const constexpr bool value = false;
+	};
+	
+	template <typename First, typename... Rest> struct HasBackReference<Sequence<First, Rest...>>
+	{
+		static const constexpr bool value = HasBackReference<First>::value || HasBackReference<Sequence<Rest...>>::value;
+	};
+	
+	template <typename... Options> struct HasBackReference<Selection<Options...>>: HasBackReference<Sequence<Options...>> { };
+	template <unsigned int id, typename MemoryType, typename... Inner> struct HasBackReference<CatchContent<id, MemoryType, Inner...>>: HasBackReference<Sequence<Inner...>> { };
+	template <unsigned int min, unsigned int max, typename... Inner> struct HasBackReference<Repeat<min, max, Inner...>>: HasBackReference<Sequence<Inner...>> { };
+	template <unsigned int min, unsigned int max, typename... Inner> struct HasBackReference<PossessiveRepeat<min, max, Inner...>>: HasBackReference<Sequence<Inner...>> { };
+	template <typename... Inner> struct HasBackReference<Atomic<Inner...>>: HasBackReference<Sequence<Inner...>> { };
+	template <unsigned int part, typename... Inner> struct HasBackReference<Debug<part, Inner...>>: HasBackReference<Sequence<Inner...>> { };
+	template <typename... Inner> struct HasBackReference<Eat<Inner...>>: HasBackReference<Sequence<Inner...>> { };
+	
+	// saved state of object used in backtracking (stateless objects aren't saved at all)
+	// it's scratch space: copying of snapshot doesn't copy its content, so buffers are reused between matches
+	
+	template <typename T> struct ScratchCopy
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t &, unsigned int, Root &, Reference<NearestRight>, Right...)
+		T copy;
+		ScratchCopy() = default;
+		ScratchCopy(const ScratchCopy &): copy{} { }
+		ScratchCopy & operator=(const ScratchCopy &)
 		{
-			if (string.isEnd())
-			{
-				// there is no need for calling rest of call-chain
-				return true;
-			}
-			return false;
+			return *this;
 		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		void save(const T & orig)
 		{
-			return false;
+			copy = orig;
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		void load(T & orig) const
 		{
-			return 0;
+			orig = copy;
 		}
 	};
 	
-	// templated struct which represent string (sequence of characters) in regexp
-	template <wchar_t firstCode, wchar_t... codes> struct String<firstCode, codes...>
+	// only states of catches and identifiers are saved, nodes around them are walked
+	// (snapshots of inner cycles are scratch space of their match, so size of snapshot doesn't grow with nesting of cycles)
+	template <typename T, bool have = CheckMemory<T>::have> struct Snapshot: ScratchCopy<T> { };
+	
+	template <typename T> struct Snapshot<T, false>
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		void save(const T &) { }
+		void load(T &) const { }
+	};
+	
+	template <unsigned int key, unsigned int value> struct Snapshot<Identifier<key, value>, true>
+	{
+		bool matched{false};
+		void save(const Identifier<key, value> & orig)
 		{
-			size_t pos{0};
-			if (checkString(string, pos, deep))
-			{
-				DEBUG_PRINTF("checkString match (pos = %zu)\n",pos);
-				size_t pos2{0};
-				if (nright.getRef().match(string.add(pos), pos2, deep, root, right...))
-				{
-					move = pos+pos2;
-					return true;
-				}
-				DEBUG_PRINT("nright not match.\n");
-			}
-			else
-			{
-				DEBUG_PRINTF("String: Character '%c' is different to requested character (first: '%c') .get(). NOT match\n", *string.str, firstCode);
-			}
-			return false;
+			matched = orig.matched;
 		}
-		template <typename StringAbstraction> static inline bool checkString(const StringAbstraction string, size_t & move, unsigned int deep)
+		void load(Identifier<key, value> & orig) const
 		{
-			size_t pos{0};
-			if (string.equal(firstCode))
-			{
-				DEBUG_PRINTF("Character '%c' compared with '%c' .get(). match\n", *string.str, firstCode);
-				if (String<codes...>::checkString(string.add(1), pos, deep))
-				{
-					move = pos+1;
-					return true;
-				}
-			}
-			else
-			{
-				DEBUG_PRINTF("Character '%c' compared with '%c' .get(). NOT match\n", *string.str, firstCode);
-			}
-			return false;
+			orig.matched = matched;
 		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+	};
+	
+	// snapshots of two parts, stateless part doesn't take any space
+	template <typename A, typename B, bool a = CheckMemory<A>::have, bool b = CheckMemory<B>::have> struct SnapshotPair
+	{
+		Snapshot<A> first;
+		Snapshot<B> second;
+		void save(const A & x, const B & y)
 		{
-			return false;
+			first.save(x);
+			second.save(y);
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		void load(A & x, B & y) const
 		{
-			return 0;
+			first.load(x);
+			second.load(y);
 		}
 	};
 	
-	// empty string always match if rest of callchain match
-	template <> struct String<>
+	template <typename A, typename B> struct SnapshotPair<A, B, true, false>
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		Snapshot<A> first;
+		void save(const A & x, const B &)
 		{
-			return nright.getRef().match(string, move, deep, root, right...);
+			first.save(x);
 		}
-		template <typename StringAbstraction> static inline bool checkString(const StringAbstraction, size_t &, unsigned int)
+		void load(A & x, B &) const
 		{
-			return true;
+			first.load(x);
 		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+	};
+	
+	template <typename A, typename B> struct SnapshotPair<A, B, false, true>
+	{
+		Snapshot<B> second;
+		void save(const A &, const B & y)
 		{
-			return false;
+			second.save(y);
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		void load(A &, B & y) const
 		{
-			return 0;
+			second.load(y);
 		}
 	};
 	
-	// templated struct which represent character range in regexp [a-z] or [a-zX-Y...]
-	template <bool positive, wchar_t a, wchar_t b, wchar_t... rest> struct CharacterRange<positive, a, b, rest...>
+	template <unsigned int id, typename MemoryType, typename Inner> struct Snapshot<CatchContent<id, MemoryType, Inner>, true>: Snapshot<Inner>
 	{
-		static const constexpr bool isEmpty{false};
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		ScratchCopy<MemoryType> memory;
+		void save(const CatchContent<id, MemoryType, Inner> & orig)
 		{
-			if ((positive && checkChar(string, deep)) || (!positive && !checkChar(string, deep) && !string.isEnd()))
-			{
-				size_t pos{0};
-				if (nright.getRef().match(string.add(1), pos, deep, root, right...))
-				{
-					move = pos+1;
-					return true;
-				}
-			}
-			else
-			{
-				DEBUG_PRINTF("Character '%c' is different to requested character ('%c' - '%c') .get(). NOT match\n", *string.str, a, b);
-			}
-			return false;
+			memory.save(orig.memory);
+			Snapshot<Inner>::save(orig);
 		}
-		template <typename StringAbstraction> static inline bool checkChar(const StringAbstraction string, unsigned int deep)
+		void load(CatchContent<id, MemoryType, Inner> & orig) const
 		{
-			if (string.charIsBetween(a,b)) 
-			{
-				DEBUG_PRINTF("Character compared with '%c'-'%c' .get(). match\n", a,b);
-				return true;
-			}
-			else if (!CharacterRange<positive, rest...>::isEmpty && CharacterRange<positive, rest...>::checkChar(string, deep)) return true;
-			else return false;
+			memory.load(orig.memory);
+			Snapshot<Inner>::load(orig);
 		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+	};
+	
+	template <typename First, typename... Rest> struct Snapshot<Sequence<First, Rest...>, true>
+	{
+		SnapshotPair<First, Sequence<Rest...>> parts;
+		void save(const Sequence<First, Rest...> & orig)
 		{
-			return false;
+			parts.save(orig, orig.rest);
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		void load(Sequence<First, Rest...> & orig) const
 		{
-			return 0;
+			parts.load(orig, orig.rest);
 		}
 	};
 	
-	// empty character range which represent ANY character . sign
-	template <bool positive> struct CharacterRange<positive>
+	template <typename First> struct Snapshot<Sequence<First>, true>: Snapshot<First> { };
+	
+	template <typename FirstOption, typename... Options> struct Snapshot<Selection<FirstOption, Options...>, true>
 	{
-		static const constexpr bool isEmpty{true};
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		SnapshotPair<FirstOption, Selection<Options...>> options;
+		void save(const Selection<FirstOption, Options...> & orig)
 		{
-			if ((positive && checkChar(string, deep)) || (!positive && !checkChar(string, deep) && !string.isEnd()))
-			{
-				size_t pos{0};
-				if (nright.getRef().match(string.add(1), pos, deep, root, right...))
-				{
-					move = pos+1;
-					return true;
-				}
-			}
-			else
-			{
-				DEBUG_PRINTF("Character '%c' is different to requested character .get(). NOT match\n", *string.str);
-			}
-			return false;
+			options.save(orig, orig.rest);
 		}
-		template <typename StringAbstraction> static inline bool checkChar(const StringAbstraction string, unsigned int)
+		void load(Selection<FirstOption, Options...> & orig) const
 		{
-			if (string.exists()) 
-			{
-				DEBUG_PRINT("Character compared with ANY .get(). match\n");
-				return true;
-			}
-			return false;
+			options.load(orig, orig.rest);
 		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+	};
+	
+	// nodes with more inner parts and wrappers are saved as node they derive from
+	template <unsigned int id, typename MemoryType, typename Inner, typename Second, typename... Rest> struct Snapshot<CatchContent<id, MemoryType, Inner, Second, Rest...>, true>: Snapshot<CatchContent<id, MemoryType, Sequence<Inner, Second, Rest...>>> { };
+	template <unsigned int min, unsigned int max, typename Inner> struct Snapshot<Repeat<min, max, Inner>, true>: Snapshot<Inner> { };
+	template <unsigned int min, unsigned int max, typename Inner, typename Second, typename... Rest> struct Snapshot<Repeat<min, max, Inner, Second, Rest...>, true>: Snapshot<Sequence<Inner, Second, Rest...>> { };
+	template <unsigned int min, unsigned int max, typename... Inner> struct Snapshot<PossessiveRepeat<min, max, Inner...>, true>: Snapshot<Repeat<min, max, Inner...>> { };
+	template <typename... Inner> struct Snapshot<Atomic<Inner...>, true>: Snapshot<Sequence<Inner...>> { };
+	template <unsigned int part, typename... Inner> struct Snapshot<Debug<part, Inner...>, true>: Snapshot<Sequence<Inner...>> { };
+	
+	template <typename... Rest> struct AllRightContext;
+	
+	template <unsigned int position> struct AllRightContext<Reference<Closure, position>>
+	{
+		AllRightContext(Reference<Closure, position>) { }
+		void remember(Reference<Closure, position>) { }
+		void restore(Reference<Closure, position>) { }
+		static const constexpr bool haveMemory{false};
+		static void visualize(Reference<Closure, position>) { }
+		void visualizeMe() const { }
+	};
+	
+	// continuation which ends one cycle (see Repeat::searchMatch) has no state
+	template <> struct AllRightContext<>
+	{
+		AllRightContext() { }
+		void remember() { }
+		void restore() { }
+		static const constexpr bool haveMemory{false};
+		static void visualize() { }
+		void visualizeMe() const { }
+	};
+	
+	// only objects with state are stored, content of storage before first remember() is never used
+	template <typename T> inline T initialCopy(T &, std::true_type)
+	{
+		return T{};
+	}
+	
+	// objects without default constructor (marks) are cheap to copy
+	template <typename T> inline T initialCopy(T & obj, std::false_type)
+	{
+		return obj;
+	}
+	
+	template <typename T, bool have = CheckMemory<T>::have> struct RightStorage
+	{
+		T objCopy;
+		RightStorage(T & obj): objCopy(initialCopy(obj, std::is_default_constructible<T>{})) { }
+		void remember(T & obj)
 		{
-			return false;
+			objCopy = std::move(obj);
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		void restore(T & obj)
 		{
-			return 0;
+			obj = std::move(objCopy);
 		}
-	};	
+		void visualizeMe() const
+		{
+			objCopy.visualize();
+		}
+	};
 	
-	// templated struct which represents list of chars in regexp [abcdef..] or just one character
-	template <bool positive, wchar_t firstCode, wchar_t... code> struct CharacterClass<positive, firstCode, code...>
+	template <typename T> struct RightStorage<T, false>
 	{
-		static const constexpr bool isEmpty{false};
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		RightStorage(T &) { }
+		void remember(T &) { }
+		void restore(T &) { }
+		void visualizeMe() const { }
+	};
+	
+	template <typename T, unsigned int position, typename... Rest> struct AllRightContext<Reference<T, position>, Rest...>
+	{
+		RightStorage<T> storage;
+		AllRightContext<Rest...> rest;
+		AllRightContext(Reference<T, position> ref, Rest... irest): storage{ref.getRef()}, rest{irest...} { }
+		void remember(Reference<T, position> ref, Rest... irest)
 		{
-			if ((positive && checkChar(string, deep)) || (!positive && !checkChar(string, deep) && !string.isEnd()))
-			{
-				size_t pos{0};
-				if (nright.getRef().match(string.add(1), pos, deep, root, right...))
-				{
-					move = pos+1;
-					return true;
-				}
-			}
-			else
+			if (haveMemory)
 			{
-				DEBUG_PRINTF("Character '%c' is different to requested character (first: '%c') .get(). NOT match\n", *string.str, firstCode);
+				storage.remember(ref.getRef());
+				rest.remember(irest...);
 			}
-			return false;
 		}
-		template <typename StringAbstraction> static inline bool checkChar(const StringAbstraction string, unsigned int deep)
+		void restore(Reference<T, position> ref, Rest... irest)
 		{
-			if (string.equal(firstCode)) 
+			if (haveMemory)
 			{
-				DEBUG_PRINTF("Character compared with '%c' .get(). match\n", firstCode);
-				return true;
+				storage.restore(ref.getRef());
+				rest.restore(irest...);
 			}
-			else if (!CharacterClass<positive, code...>::isEmpty && CharacterClass<positive, code...>::checkChar(string, deep)) return true;
-			else return false;
-		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		}	
+		static const constexpr bool haveMemory{CheckMemory<T>::have || AllRightContext<Rest...>::haveMemory};
+		void visualizeMe() const
 		{
-			return false;
+			storage.visualizeMe();
+			rest.visualizeMe();
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		static void visualize(Reference<T, position> ref, Rest... irest)
 		{
-			return 0;
+			ref.getRef().visualize();
+			AllRightContext<Rest...>::visualize(irest...);
 		}
 	};
 	
-	// empty character represents ANY . character
-	template <bool positive> struct CharacterClass<positive>
+	
+	template <unsigned int position = 0, typename T> inline Reference<T, position> makeRef(T & target)
 	{
-		static const constexpr bool isEmpty{true};
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
-		{
-			if ((positive && checkChar(string, deep)) || (!positive && !checkChar(string, deep) && !string.isEnd()))
-			{
-				size_t pos{0};
-				if (nright.getRef().match(string.add(1), pos, deep, root, right...))
-				{
-					move = pos+1;
-					return true;
-				}
-			}
-			else
-			{
-				DEBUG_PRINTF("Character '%c' is different to requested character .get(). NOT match\n", *string.str);
-			}
-			return false;
+		return Reference<T, position>(target);
+	}
+	
+	// pair representing "catched" content from input
+	struct Catch
+	{
+		uint32_t begin;
+		uint32_t length;
+	};
+	
+	// object which represent all of "catched" pairs, support for range-based FOR
+	struct CatchReturn {
+	protected:
+		const Catch * vdata;
+		size_t vsize;
+	public:
+		size_t size() const {
+			return vsize;
 		}
-		template <typename StringAbstraction> static inline bool checkChar(const StringAbstraction string, unsigned int)
-		{
-			if (string.exists()) 
-			{
-				DEBUG_PRINT("Character compared with ANY .get(). match\n");
-				return true;
-			}
-			return false;
+		const Catch * data() const {
+			return vdata;
 		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
-		{
-			return false;
+		CatchReturn(): vdata{nullptr}, vsize{0} { }
+		CatchReturn(const Catch * ldata, size_t lsize): vdata{ldata}, vsize{lsize} { }
+		const Catch * get(const size_t id) {
+			if (id < vsize) return &vdata[id];
+			else return nullptr;
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		const Catch * last() const {
+			if (vsize) return &vdata[vsize - 1];
+			else return nullptr;
+		}
+		const Catch * begin() const {
+			return vdata;
+		}
+		const Catch * end() const {
+			return (vdata + vsize);
+		}
+		const Catch operator[](unsigned int id)
 		{
-			return 0;
+			if (id < vsize) return vdata[id];
+			else return Catch{0,0};
 		}
 	};
 	
-	// templated struct which represent catch-of-content braces in regexp, ID is unique identify of this content	
-	template <unsigned int id, typename MemoryType, typename Inner, typename... Rest> struct CheckMemory<CatchContent<id, MemoryType, Inner, Rest...>>
-	{
-		static const constexpr bool have = true;
-	};
+	// catchid of back-reference to most recent catch (e.g. from last repetition of cycle), it's \N in PCRE
+	static const constexpr unsigned int lastCatch{~0u};
 	
-	template <unsigned int id, typename MemoryType, typename Inner, typename... Rest> struct CatchContent<id, MemoryType, Inner, Rest...>: public CatchContent<id, MemoryType, Seq<Inner,Rest...>>
+	template <unsigned int id, typename T, typename... Tx> inline bool getCatchFromSubrexpHelper(CatchReturn & catches, T & from, Tx &... next)
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		if (!from.template getCatch<id>(catches))
 		{
-			return CatchContent<id, MemoryType, Seq<Inner,Rest...>>::match(string, move, deep, root, nright, right...);
+			return getCatchFromSubrexpHelper(catches, next...);
 		}
-		inline void reset()
+		else
 		{
-			CatchContent<id, MemoryType, Seq<Inner,Rest...>>::reset();
+			return true;
 		}
-		template <unsigned int subid> inline bool getCatch(CatchReturn & catches) const
+	}
+	
+	template <unsigned int id, typename T> inline bool getCatchFromSubrexpHelper(CatchReturn & catches, T & from)
+	{
+		return from.template getCatch<id>(catches);
+	}
+	
+	template <unsigned int id, typename T, typename... Tx> inline CatchReturn getCatchFromSubrexp(T & from, Tx &... next)
+	{
+		CatchReturn catches;
+		getCatchFromSubrexpHelper<id>(catches, from, next...);
+		return catches;
+	}
+	
+	// static-allocated memory which contains "catched" pairs
+	
+	template <size_t size> struct StaticMemory
+	{
+	protected:
+		uint32_t count{0};
+		Catch data[size];
+	public:
+		inline void reset()
 		{
-			return CatchContent<id, MemoryType, Seq<Inner,Rest...>>::template getCatch<subid>(catches);
+			count = 0;
 		}
-		template <unsigned int key> inline unsigned int getIdentifier() const
+		// unused part isn't initialized (regexp can be const object)
+		StaticMemory() { }
+		// only used part is copied (snapshots in cycles are cheap)
+		StaticMemory(const StaticMemory & right): count{right.count}
 		{
-			return CatchContent<id, MemoryType, Seq<Inner,Rest...>>::template getIdentifier<key>();
+			memcpy(data, right.data, count * sizeof(Catch));
 		}
-	};
-	
-	// just one inner regexp variant of catch-of-content
-	template <unsigned int id, typename MemoryType> struct XMark
-	{
-		MemoryType & memory;
-		
-		uint32_t begin;
-		uint32_t len{0};
-		
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		StaticMemory & operator=(const StaticMemory & right)
 		{
-			// checkpoint => set length
-			len = string.getPosition() - begin + 1;
-			return nright.getRef().match(string, move, deep, root, right...);
-			
+			count = right.count;
+			memcpy(data, right.data, count * sizeof(Catch));
+			return *this;
 		}
-		inline void reset()
+		StaticMemory & operator=(StaticMemory && right)
 		{
-			len = 0;
+			count = right.count;
+			memcpy(data, right.data, count * sizeof(Catch));
+			right.count = 0;
+			return *this;
 		}
-		XMark(uint32_t lbegin, MemoryType & lmemory): memory{lmemory}, begin{lbegin}
+		void set(unsigned int addr, Catch content)
 		{
-			
+			if (addr < size) data[addr] = content;
 		}
-		XMark(const XMark & orig) = default;
-		void transfer(MemoryType & memory) const
+		int add(Catch content)
 		{
-			if (len)
+			if (count < size) 
 			{
-				memory.add({begin,len-1});
+				unsigned int ret = count++;
+				data[ret] = content;
+				return ret;
 			}
+			return -1;
 		}
-		XMark & operator=(const XMark & orig)
+		size_t getCount() const
 		{
-			begin = orig.begin;
-			len = orig.len;
-			return *this;
+			return count;
+		}
+		void truncate(size_t lcount)
+		{
+			if (lcount < count) count = static_cast<uint32_t>(lcount);
+		}
+		CatchReturn getCatches() const
+		{
+			return CatchReturn{data, count};
 		}
 	};
 	
-	template <unsigned int id, typename MemoryType, typename Inner> struct CheckMemory<CatchContent<id, MemoryType, Inner>>
-	{
-		static const constexpr bool have = true;
-	};
+	// dynamic-allocated memory (based on std::vector) which contains "catched" pairs
 	
-	template <unsigned int id, typename MemoryType, typename Inner> struct CatchContent<id, MemoryType, Inner>: public Inner
+	struct DynamicMemory
 	{
-		MemoryType memory;
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+	protected:
+		std::vector<Catch> data;
+	public:
+		inline void reset()
 		{
-			XMark<id, MemoryType> mark{static_cast<uint32_t>(string.getPosition()), memory};
-			bool ret{Inner::match(string, move, deep, root, makeRef(mark), nright, right...)};
-			if (ret)
-			{
-				mark.transfer(memory);
-			}
-			return ret;
+			data.resize(0);
 		}
-		inline void reset()
+		DynamicMemory() = default;
+		DynamicMemory(const DynamicMemory & right) = default;
+		DynamicMemory(DynamicMemory && right) = default;
+		DynamicMemory & operator=(const DynamicMemory & right) = default;
+		// buffers are exchanged (not released), so backtracking in cycles doesn't allocate again
+		DynamicMemory & operator=(DynamicMemory && right)
 		{
-			memory.reset();
+			data.swap(right.data);
+			right.data.clear();
+			return *this;
 		}
-		template <unsigned int subid> inline bool getCatch(CatchReturn & catches) const
+		void set(unsigned int addr, Catch content)
 		{
-			if (subid == id) 
-			{
-				catches = memory.getCatches();
-				return true;
-			}
-			else return Inner::template getCatch<subid>(catches);
+			if (addr < getCount()) data[addr] = content;
 		}
-		template <unsigned int key> inline unsigned int getIdentifier() const
+		int add(Catch content)
 		{
-			return Inner::template getIdentifier<key>();
+			data.push_back(content);
+			return data.size()-1;
 		}
-	};
-	
-	// templated struct which represents string with content from catch (not regexp anymore :) 
-	// in style: ^([a-z]+)\1$ for catching string in style "abcabc" (in catch is just "abc")
-	template <unsigned int baseid, unsigned int catchid> struct ReCatch
-	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		size_t getCount() const
 		{
-			CatchReturn ret;
-			if (root.template getCatch<baseid>(ret)) {
-				//printf("catch found (size = %zu)\n",ret.size());
-				const Catch * ctch{ret.get(catchid)};
-				if (ctch) {
-					//printf("subcatch found\n");
-					for (size_t l{0}; l != ctch->length; ++l) {
-						if (!string.equalToOriginal(ctch->begin+(ctch->length-l-1),l)) return false;
-					}
-					size_t tmp{0};
-					if (nright.getRef().match(string.add(ctch->length), tmp, deep, root, right...))
-					{
-						move += ctch->length + tmp;
-						return true;
-					}
-				}
-			}
-			return false;
+			return data.size();
 		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		void truncate(size_t count)
 		{
-			return false;
+			if (count < data.size()) data.resize(count);
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		CatchReturn getCatches() const
 		{
-			return 0;
+			return CatchReturn{data.data(), getCount()};
 		}
 	};
 	
-	template <unsigned int baseid, unsigned int catchid> struct ReCatchReverse
+	// bump storage of catches shared by all ArenaMemory of one matching state, it's reclaimed at once when matching begins
+	// every catch is cell linked to previous catch of same memory, cells are never changed, so older lists stay valid
+	struct CatchArena
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
-		{
-			CatchReturn ret;
-			if (root.template getCatch<baseid>(ret)) {
-				//printf("catch found (size = %zu)\n",ret.size());
-				const Catch * ctch{ret.get(catchid)};
-				if (ctch) {
-					//printf("subcatch found\n");
-					for (size_t l{0}; l != ctch->length; ++l) {
-						if (!string.equalToOriginal(ctch->begin+l,l)) return false;
-					}
-					size_t tmp{0};
-					if (nright.getRef().match(string.add(ctch->length), tmp, deep, root, right...))
-					{
-						move += ctch->length + tmp;
-						return true;
-					}
-				}
-			}
-			return false;
-		}
-		inline void reset() { }
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		struct Cell
+		{
+			Catch content;
+			uint32_t previous; // index of previous cell + 1 (0 is end of list)
+		};
+		std::vector<Cell> cells;
+		// lists from older generations aren't valid anymore
+		uint64_t generation{1};
+		inline void reset()
 		{
-			return false;
+			cells.resize(0);
+			++generation;
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		uint32_t push(Catch content, uint32_t previous)
 		{
-			return 0;
+			cells.push_back({content, previous});
+			return static_cast<uint32_t>(cells.size());
 		}
 	};
 	
-	// identify path thru regexp
-	template <unsigned int key, unsigned int value> struct Identifier
+	// memory which contains "catched" pairs as list in arena of matching state
+	// copy is just watermark (end of list and count), so snapshots in cycles don't copy catches and nothing is released after match
+	struct ArenaMemory
 	{
-		bool matched{false};
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+	protected:
+		CatchArena * arena{nullptr};
+		uint32_t last{0};
+		uint32_t count{0};
+		// catches in order (made when they are read)
+		mutable std::vector<Catch> view;
+		mutable uint64_t viewGeneration{0};
+		mutable uint32_t viewLast{0};
+		const CatchArena::Cell & cell(uint32_t index) const
 		{
-			if (nright.getRef().match(string, move, deep, root, right...))
-			{
-				matched = true;
-				return true;
-			}
-			else 
-			{
-				matched = false;
-				return false;
-			}
+			return arena->cells[index - 1];
 		}
+	public:
 		inline void reset()
 		{
-			matched = false;
+			last = count = 0;
+		}
+		ArenaMemory() = default;
+		// own view isn't copied (it's made again when needed)
+		ArenaMemory(const ArenaMemory & right): arena{right.arena}, last{right.last}, count{right.count} { }
+		ArenaMemory & operator=(const ArenaMemory & right)
+		{
+			arena = right.arena;
+			last = right.last;
+			count = right.count;
+			return *this;
+		}
+		ArenaMemory & operator=(ArenaMemory && right)
+		{
+			operator=(right);
+			right.reset();
+			return *this;
+		}
+		void bind(CatchArena & larena)
+		{
+			arena = &larena;
+		}
+		int add(Catch content)
+		{
+			last = arena->push(content, last);
+			return static_cast<int>(count++);
+		}
+		size_t getCount() const
+		{
+			return count;
+		}
+		void truncate(size_t lcount)
+		{
+			for (; count > lcount; --count) last = cell(last).previous;
+		}
+		CatchReturn getCatches() const
+		{
+			if (!count) return CatchReturn{};
+			if (viewGeneration != arena->generation || viewLast != last || view.size() != count)
+			{
+				view.resize(count);
+				uint32_t index{last};
+				for (uint32_t i{count}; i != 0; --i)
+				{
+					view[i - 1] = cell(index).content;
+					index = cell(index).previous;
+				}
+				viewGeneration = arena->generation;
+				viewLast = last;
+			}
+			return CatchReturn{view.data(), count};
+		}
+	};
+	
+	// memory in arena gets arena of state (root) when its catch is matched
+	template <typename MemoryType, typename Root> inline void bindMemory(MemoryType &, Root &) { }
+	
+	template <typename Root> inline void bindMemory(ArenaMemory & memory, Root & root)
+	{
+		memory.bind(root.arena);
+	}
+	
+	// pattern has catch in arena (copy of state can't refer to arena of original)
+	template <typename T> struct UsesArena;
+	
+	template <typename List> struct NodeListUsesArena
+	{
+		static const constexpr bool value = false;
+	};
+	
+	template <typename First, typename... Rest> struct NodeListUsesArena<NodeList<First, Rest...>>
+	{
+		static const constexpr bool value = UsesArena<First>::value || NodeListUsesArena<NodeList<Rest...>>::value;
+	};
+	
+	template <typename T> struct UsesArena
+	{
+		static const constexpr bool value = NodeListUsesArena<typename Children<T>::Type>::value;
+	};
+	
+	template <unsigned int id, typename... Inner> struct UsesArena<CatchContent<id, ArenaMemory, Inner...>>
+	{
+		static const constexpr bool value = true;
+	};
+	
+	// catch storage sized at compile time: bound is how many times catch can be repeated (product of max of enclosing cycles, 0 is unbounded)
+	// dynamic memory of catch with small bound is replaced with static one, so matching doesn't allocate and whole storage is part of regexp object
+	static const constexpr size_t staticCatchLimit{16};
+	
+	template <size_t bound, unsigned int max> struct CycleBound
+	{
+		// product is compared as bound > limit / max (it can't overflow)
+		static const constexpr size_t value = (!bound || !max || bound > staticCatchLimit / max) ? 0 : bound * max;
+	};
+	
+	template <typename T, size_t bound> struct SizedCatches
+	{
+		using Type = T;
+	};
+	
+	template <typename... Parts, size_t bound> struct SizedCatches<Sequence<Parts...>, bound>
+	{
+		using Type = Sequence<typename SizedCatches<Parts, bound>::Type...>;
+	};
+	
+	template <typename... Options, size_t bound> struct SizedCatches<Selection<Options...>, bound>
+	{
+		using Type = Selection<typename SizedCatches<Options, bound>::Type...>;
+	};
+	
+	template <typename... Inner, size_t bound> struct SizedCatches<Atomic<Inner...>, bound>
+	{
+		using Type = Atomic<typename SizedCatches<Inner, bound>::Type...>;
+	};
+	
+	template <unsigned int part, typename... Inner, size_t bound> struct SizedCatches<Debug<part, Inner...>, bound>
+	{
+		using Type = Debug<part, typename SizedCatches<Inner, bound>::Type...>;
+	};
+	
+	template <unsigned int min, unsigned int max, typename... Inner, size_t bound> struct SizedCatches<Repeat<min, max, Inner...>, bound>
+	{
+		using Type = Repeat<min, max, typename SizedCatches<Inner, CycleBound<bound, max>::value>::Type...>;
+	};
+	
+	template <unsigned int min, unsigned int max, typename... Inner, size_t bound> struct SizedCatches<PossessiveRepeat<min, max, Inner...>, bound>
+	{
+		using Type = PossessiveRepeat<min, max, typename SizedCatches<Inner, CycleBound<bound, max>::value>::Type...>;
+	};
+	
+	// memory chosen by user is kept
+	template <unsigned int id, typename MemoryType, typename... Inner, size_t bound> struct SizedCatches<CatchContent<id, MemoryType, Inner...>, bound>
+	{
+		using Type = CatchContent<id, MemoryType, typename SizedCatches<Inner, bound>::Type...>;
+	};
+	
+	template <unsigned int id, typename... Inner, size_t bound> struct SizedCatches<CatchContent<id, DynamicMemory, Inner...>, bound>
+	{
+		using Type = CatchContent<id, typename std::conditional<(bound > 0), StaticMemory<bound ? bound : 1>, DynamicMemory>::type, typename SizedCatches<Inner, bound>::Type...>;
+	};
+	
+	// struct which represents Begin ^ regexp sign (matching for first-position)
+	struct Begin
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if (string.isBegin())
+			{
+				if (nright.match(string, move, deep, root, right...))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// struct which represent End $ regexp sign (matching for end-of-input)
+	struct End
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			// rest of call-chain can match only empty string (as in PCRE, a$b never matches)
+			if (string.isEnd()) return nright.match(string, move, deep, root, right...);
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// templated struct which represent string (sequence of characters) in regexp
+	template <wchar_t firstCode, wchar_t... codes> struct String<firstCode, codes...>
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			size_t pos{0};
+			if (checkString(string, pos, deep))
+			{
+				DEBUG_PRINTF("checkString match (pos = %zu)\n",pos);
+				size_t pos2{0};
+				if (nright.match(string.add(pos), pos2, deep, root, right...))
+				{
+					move = pos+pos2;
+					return true;
+				}
+				DEBUG_PRINT("nright not match.\n");
+			}
+			else
+			{
+				DEBUG_PRINTF("String: Character '%c' is different to requested character (first: '%c') .get(). NOT match\n", *string.str, firstCode);
+			}
+			return false;
+		}
+		template <typename StringAbstraction> static inline bool checkString(const StringAbstraction string, size_t & move, unsigned int deep)
+		{
+			size_t pos{0};
+			if (string.equal(firstCode))
+			{
+				DEBUG_PRINTF("Character '%c' compared with '%c' .get(). match\n", *string.str, firstCode);
+				if (String<codes...>::checkString(string.add(1), pos, deep))
+				{
+					move = pos+1;
+					return true;
+				}
+			}
+			else
+			{
+				DEBUG_PRINTF("Character '%c' compared with '%c' .get(). NOT match\n", *string.str, firstCode);
+			}
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// empty string always match if rest of callchain match
+	template <> struct String<>
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			return nright.match(string, move, deep, root, right...);
+		}
+		template <typename StringAbstraction> static inline bool checkString(const StringAbstraction, size_t &, unsigned int)
+		{
+			return true;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// templated struct which represent character range in regexp [a-z] or [a-zX-Y...]
+	template <bool positive, wchar_t a, wchar_t b, wchar_t... rest> struct CharacterRange<positive, a, b, rest...>
+	{
+		static const constexpr bool isEmpty{false};
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if (string.template inSet<FirstCharacter<CharacterRange>>())
+			{
+				size_t pos{0};
+				if (nright.match(string.add(1), pos, deep, root, right...))
+				{
+					move = pos+1;
+					return true;
+				}
+			}
+			else
+			{
+				DEBUG_PRINTF("Character '%c' is different to requested character ('%c' - '%c') .get(). NOT match\n", *string.str, a, b);
+			}
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// empty character range which represent ANY character . sign
+	template <bool positive> struct CharacterRange<positive>
+	{
+		static const constexpr bool isEmpty{true};
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if ((positive && checkChar(string, deep)) || (!positive && !checkChar(string, deep) && !string.isEnd()))
+			{
+				size_t pos{0};
+				if (nright.match(string.add(1), pos, deep, root, right...))
+				{
+					move = pos+1;
+					return true;
+				}
+			}
+			else
+			{
+				DEBUG_PRINTF("Character '%c' is different to requested character .get(). NOT match\n", *string.str);
+			}
+			return false;
+		}
+		template <typename StringAbstraction> static inline bool checkChar(const StringAbstraction string, unsigned int)
+		{
+			if (string.exists()) 
+			{
+				DEBUG_PRINT("Character compared with ANY .get(). match\n");
+				return true;
+			}
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};	
+	
+	// templated struct which represents list of chars in regexp [abcdef..] or just one character
+	template <bool positive, wchar_t firstCode, wchar_t... code> struct CharacterClass<positive, firstCode, code...>
+	{
+		static const constexpr bool isEmpty{false};
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if (string.template inSet<FirstCharacter<CharacterClass>>())
+			{
+				size_t pos{0};
+				if (nright.match(string.add(1), pos, deep, root, right...))
+				{
+					move = pos+1;
+					return true;
+				}
+			}
+			else
+			{
+				DEBUG_PRINTF("Character '%c' is different to requested character (first: '%c') .get(). NOT match\n", *string.str, firstCode);
+			}
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// empty character represents ANY . character
+	template <bool positive> struct CharacterClass<positive>
+	{
+		static const constexpr bool isEmpty{true};
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if ((positive && checkChar(string, deep)) || (!positive && !checkChar(string, deep) && !string.isEnd()))
+			{
+				size_t pos{0};
+				if (nright.match(string.add(1), pos, deep, root, right...))
+				{
+					move = pos+1;
+					return true;
+				}
+			}
+			else
+			{
+				DEBUG_PRINTF("Character '%c' is different to requested character .get(). NOT match\n", *string.str);
+			}
+			return false;
+		}
+		template <typename StringAbstraction> static inline bool checkChar(const StringAbstraction string, unsigned int)
+		{
+			if (string.exists()) 
+			{
+				DEBUG_PRINT("Character compared with ANY .get(). match\n");
+				return true;
+			}
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// templated struct which represent catch-of-content braces in regexp, ID is unique identify of this content	
+	template <unsigned int id, typename MemoryType, typename Inner, typename... Rest> struct CatchContent<id, MemoryType, Inner, Rest...>: public CatchContent<id, MemoryType, Seq<Inner,Rest...>>
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			return CatchContent<id, MemoryType, Seq<Inner,Rest...>>::template match<position>(string, move, deep, root, nright, right...);
+		}
+		inline void reset()
+		{
+			CatchContent<id, MemoryType, Seq<Inner,Rest...>>::reset();
+		}
+		template <unsigned int subid> inline bool getCatch(CatchReturn & catches) const
+		{
+			return CatchContent<id, MemoryType, Seq<Inner,Rest...>>::template getCatch<subid>(catches);
+		}
+		template <unsigned int key> inline unsigned int getIdentifier() const
+		{
+			return CatchContent<id, MemoryType, Seq<Inner,Rest...>>::template getIdentifier<key>();
+		}
+	};
+	
+	// just one inner regexp variant of catch-of-content
+	template <unsigned int id, typename MemoryType> struct XMark
+	{
+		MemoryType & memory;
+		
+		uint32_t begin;
+		uint32_t len{0};
+		
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			// checkpoint => set length
+			len = string.getPosition() - begin + 1;
+			bool ret;
+			if (!HasBackReference<Root>::value) ret = nright.match(string, move, deep, root, right...);
+			else
+			{
+				// catch is transferred to memory after whole match, back-reference in continuation must see it before
+				const size_t count{memory.getCount()};
+				memory.add({begin,len-1});
+				ret = nright.match(string, move, deep, root, right...);
+				memory.truncate(count);
+			}
+			if (!ret) Probe<CatchNode<id>, position>::backtrack(root);
+			return ret;
+		}
+		inline void reset()
+		{
+			len = 0;
+		}
+		XMark(uint32_t lbegin, MemoryType & lmemory): memory{lmemory}, begin{lbegin}
+		{
+			
+		}
+		XMark(const XMark & orig) = default;
+		void transfer(MemoryType & memory) const
+		{
+			if (len)
+			{
+				memory.add({begin,len-1});
+			}
+		}
+		XMark & operator=(const XMark & orig)
+		{
+			begin = orig.begin;
+			len = orig.len;
+			return *this;
+		}
+	};
+	
+	template <unsigned int id, typename MemoryType, typename Inner> struct CatchContent<id, MemoryType, Inner>: public Inner
+	{
+		MemoryType memory;
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			bindMemory(memory, root);
+			XMark<id, MemoryType> mark{static_cast<uint32_t>(string.getPosition()), memory};
+			const size_t before{move};
+			bool ret{Inner::template match<position + 1>(string, move, deep, root, makeRef<position>(mark), nright, right...)};
+			if (ret)
+			{
+				mark.transfer(memory);
+			}
+			return Probe<CatchNode<id>, position>::leave(root, ret, move - before);
+		}
+		inline void reset()
+		{
+			memory.reset();
+			Inner::reset();
+		}
+		template <unsigned int subid> inline bool getCatch(CatchReturn & catches) const
+		{
+			if (subid == id) 
+			{
+				catches = memory.getCatches();
+				return true;
+			}
+			else return Inner::template getCatch<subid>(catches);
+		}
+		template <unsigned int key> inline unsigned int getIdentifier() const
+		{
+			return Inner::template getIdentifier<key>();
+		}
+	};
+	
+	// templated struct which represents string with content from catch (not regexp anymore :) 
+	// in style: ^([a-z]+)\1$ for catching string in style "abcabc" (in catch is just "abc")
+	template <unsigned int baseid, unsigned int catchid> struct ReCatch
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			const size_t before{move};
+			const bool matched{referenceMatch(string, move, deep, root, nright, right...)};
+			return Probe<ReCatch, position>::leave(root, matched, move - before);
+		}
+		template <typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool referenceMatch(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			CatchReturn ret;
+			if (root.template getCatch<baseid>(ret)) {
+				//printf("catch found (size = %zu)\n",ret.size());
+				const Catch * ctch{catchid == lastCatch ? ret.last() : ret.get(catchid)};
+				if (ctch) {
+					//printf("subcatch found\n");
+					for (size_t l{0}; l != ctch->length; ++l) {
+						if (!string.equalToOriginal(ctch->begin+l,l)) return false;
+					}
+					size_t tmp{0};
+					if (nright.match(string.add(ctch->length), tmp, deep, root, right...))
+					{
+						move += ctch->length + tmp;
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	template <unsigned int baseid, unsigned int catchid> struct ReCatchReverse
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			const size_t before{move};
+			const bool matched{referenceMatch(string, move, deep, root, nright, right...)};
+			return Probe<ReCatchReverse, position>::leave(root, matched, move - before);
+		}
+		template <typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool referenceMatch(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			CatchReturn ret;
+			if (root.template getCatch<baseid>(ret)) {
+				//printf("catch found (size = %zu)\n",ret.size());
+				const Catch * ctch{catchid == lastCatch ? ret.last() : ret.get(catchid)};
+				if (ctch) {
+					//printf("subcatch found\n");
+					for (size_t l{0}; l != ctch->length; ++l) {
+						if (!string.equalToOriginal(ctch->begin+(ctch->length-l-1),l)) return false;
+					}
+					size_t tmp{0};
+					if (nright.match(string.add(ctch->length), tmp, deep, root, right...))
+					{
+						move += ctch->length + tmp;
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+		inline void reset() { }
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// identify path thru regexp
+	template <unsigned int key, unsigned int value> struct Identifier
+	{
+		bool matched{false};
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if (nright.match(string, move, deep, root, right...))
+			{
+				matched = true;
+				return true;
+			}
+			else 
+			{
+				matched = false;
+				return false;
+			}
+		}
+		inline void reset()
+		{
+			matched = false;
+		}
+		template <unsigned int> inline bool getCatch(CatchReturn &) const
+		{
+			return false;
+		}
+		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		{
+			return matched ? (key == rkey ? value : 0) : 0;
+		}
+	};
+	
+	// selection of literals (abc|def|...) is matched with anchored automaton instead of trying every option
+	template <typename... Options> struct Literals
+	{
+		static const constexpr bool all{true};
+		static const constexpr size_t maxLength{0};
+		template <typename CharType, CompareFnc<CharType>> static void collect(std::vector<Literal> &) { }
+	};
+	
+	template <typename FirstOption, typename... Options> struct Literals<FirstOption, Options...>
+	{
+		static const constexpr bool all{false};
+		static const constexpr size_t maxLength{0};
+	};
+	
+	template <wchar_t... codes, typename... Options> struct Literals<String<codes...>, Options...>
+	{
+		static const constexpr bool all{Literals<Options...>::all};
+		static const constexpr size_t maxLength{sizeof...(codes) > Literals<Options...>::maxLength ? sizeof...(codes) : Literals<Options...>::maxLength};
+		template <typename CharType, CompareFnc<CharType> compare> static std::bitset<256> position(const wchar_t code)
+		{
+			std::bitset<256> result;
+			for (unsigned int c{0}; c != 256; ++c) result[c] = compare(static_cast<CharType>(c), code, code);
+			return result;
+		}
+		template <typename CharType, CompareFnc<CharType> compare> static void collect(std::vector<Literal> & literals)
+		{
+			literals.push_back(Literal{position<CharType, compare>(codes)...});
+			Literals<Options...>::template collect<CharType, compare>(literals);
+		}
+	};
+	
+	template <typename... Options> struct LiteralSelection
+	{
+		// few options are checked faster directly, automaton is only for one-byte characters
+		template <typename CharType> using Enabled = std::integral_constant<bool, Literals<Options...>::all && (sizeof...(Options) >= 4) && std::is_same<CharType, char>::value>;
+		using Type = LiteralAutomaton;
+		template <typename CharType, CompareFnc<CharType> compare> static const LiteralAutomaton & get()
+		{
+			static const LiteralAutomaton automaton{build<CharType, compare>()};
+			return automaton;
+		}
+		template <typename CharType, CompareFnc<CharType> compare> static std::vector<Literal> build()
+		{
+			std::vector<Literal> literals;
+			Literals<Options...>::template collect<CharType, compare>(literals);
+			return literals;
+		}
+	};
+	
+	// temlated struct which represent selection in regexp (a|b|c)
+	template <typename FirstOption, typename... Options> struct Selection<FirstOption, Options...>: public FirstOption
+	{
+		Selection<Options...> rest;
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			const size_t before{move};
+			const bool matched{options<Selection, position, position>(string, move, deep, root, nright, right...)};
+			return Probe<Selection, position>::leave(root, matched, move - before);
+		}
+		// remaining options of whole selection, first of them is after option (index of node)
+		template <typename Whole, unsigned int position, unsigned int option, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool options(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			using Enabled = typename LiteralSelection<FirstOption, Options...>::template Enabled<typename StringAbstraction::CharacterType>;
+			return match<Whole, position, option>(string, move, deep, root, Enabled{}, nright, right...);
+		}
+		// every literal which is prefix of input is tried (in order of options)
+		template <typename Whole, unsigned int position, unsigned int option, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, std::true_type, Reference<NearestRight, next> nright, Right... right)
+		{
+			FoundLiteral found[Literals<FirstOption, Options...>::maxLength + 1];
+			const unsigned int count{string.template shared<LiteralSelection<FirstOption, Options...>>().find(string, found)};
+			for (unsigned int i{1}; i < count; ++i)
+			{
+				for (unsigned int j{i}; j > 0 && found[j].index < found[j-1].index; --j) std::swap(found[j], found[j-1]);
+			}
+			for (unsigned int i{0}; i != count; ++i)
+			{
+				size_t pos{0};
+				if (Memo<position, true>::match(string.add(found[i].length), root, [&]{ return nright.match(string.add(found[i].length), pos, deep+1, root, right...); }))
+				{
+					move = found[i].length + pos;
+					return true;
+				}
+				Probe<Whole, position>::backtrack(root);
+			}
+			return false;
+		}
+		template <typename Whole, unsigned int position, unsigned int option, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, std::false_type, Reference<NearestRight, next> nright, Right... right)
+		{
+			if (Memo<option + 1>::match(string, root, [&]{ return FirstOption::template match<option + 1>(string, move, deep+1, root, nright, right...); }))
+			{
+				return true;
+			}
+			else
+			{
+				//FirstOption::reset(nright, right...);
+				Probe<Whole, position>::backtrack(root);
+				return rest.template options<Whole, position, option + NodeCount<FirstOption>::value>(string, move, deep+1, root, nright, right...);
+			}
+		}
+		inline void reset()
+		{
+			FirstOption::reset();
+			rest.reset();
+		}
+		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		{
+			return FirstOption::template getCatch<id>(catches) || rest.template getCatch<id>(catches);
+		}
+		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		{
+			if (FirstOption::template getIdentifier<rkey>()) return FirstOption::template getIdentifier<rkey>();
+			else return rest.template getIdentifier<rkey>();
+		}
+	};
+	
+	// empty selection always fail
+	template <> struct Selection<>
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction, size_t &, unsigned int, Root &, Reference<NearestRight, next>, Right...)
+		{
+			return false;
+		}
+		template <typename, unsigned int, unsigned int, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool options(const StringAbstraction, size_t &, unsigned int, Root &, Reference<NearestRight, next>, Right...)
+		{
+			return false;
+		}
+		inline void reset() {}
+		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		{
+			return false;
+		}
+		template <unsigned int> inline unsigned int getIdentifier() const
+		{
+			return 0;
+		}
+	};
+	
+	// templated struct which represent sequence of another regexps 
+	// parts are after position of sequence, so rest of it is matched with position of last node before its first part
+	template <typename First, typename... Rest> struct Sequence<First, Rest...>: public First
+	{
+		Sequence<Rest...> rest;
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if (First::template match<position + 1>(string, move, deep, root, makeRef<position + NodeCount<First>::value>(rest), nright, right...))
+			{
+				return true;
+			}
+			//First::reset(nright, right...);
+			return false;
+		}
+		inline void reset()
+		{
+			First::reset();
+			rest.reset();
+		}
+		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		{
+			return First::template getCatch<id>(catches) || rest.template getCatch<id>(catches);
+		}
+		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		{
+			if (First::template getIdentifier<rkey>()) return First::template getIdentifier<rkey>();
+			else return rest.template getIdentifier<rkey>();
+		}
+	};
+
+	// sequence of just one inner regexp
+	template <typename First> struct Sequence<First>: public First
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if (First::template match<position + 1>(string, move, deep, root, nright, right...))
+			{
+				return true;
+			}
+			//First::reset(nright, right...);
+			return false;
+		}
+		inline void reset()
+		{
+			First::reset();
+		}
+		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		{
+			return First::template getCatch<id>(catches);
+		}
+		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		{
+			return First::template getIdentifier<rkey>();
+		}
+	};
+	
+	// templated struct which represents generic-loop with min,max limit
+	// ()+ "plus" cycle have min 1 and min 0 (infinity)
+	// ()* "star" cycle have min 0 and max 0 (infinity)
+	template <unsigned int min, unsigned int max, typename Inner, typename... Rest> struct Repeat<min, max, Inner, Rest...>: public Repeat<min, max, Seq<Inner,Rest...>>
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			return Repeat<min, max, Seq<Inner,Rest...>>::template match<position>(string, move, deep, root, nright, right...);
+		}
+		inline void reset()
+		{
+			Repeat<min, max, Seq<Inner,Rest...>>::reset();
+		}
+		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		{
+			return Repeat<min, max, Seq<Inner,Rest...>>::template getCatch<id>(catches);
+		}
+		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		{
+			return Repeat<min, max, Seq<Inner,Rest...>>::template getIdentifier<rkey>();
+		}
+	};
+	
+	// cycle with just one inner regexp
+	template <unsigned int min, unsigned int max, typename Inner> struct Repeat<min, max, Inner>: public Inner
+	{
+		Snapshot<Inner> innerContext;
+		// state of cycles used by last found continuation (or state before cycle when nothing was found)
+		Snapshot<Inner> foundContext;
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			const size_t before{move};
+			bool matched;
+			if (!max && root.control) matched = Memo<position>::cycle(string, root, [&]{ return cycleMatch<position>(string, move, deep, root, nright, right...); });
+			else matched = cycleMatch<position>(string, move, deep, root, nright, right...);
+			return Probe<Repeat, position>::leave(root, matched, move - before);
+		}
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool cycleMatch(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			// other way of some cycle can be needed when inner part can match more ways
+			if (!OneWay<StringAbstraction, Inner, Selection<Inner, Sequence<NearestRight, Right...>>>::value)
+			{
+				return searchMatch<position>(string, move, deep, root, nright, right...);
+			}
+			// when continuation can't begin with character which begins cycle, giving back cycles can't help
+			using Continuation = FirstCharacter<Sequence<NearestRight, Right...>>;
+			if (!FirstCharacter<Inner>::nullable && !Continuation::nullable && StringAbstraction::template disjoint<FirstCharacter<Inner>, Continuation>())
+			{
+				return possessiveMatch<position>(string, move, deep, root, nright, right...);
+			}
+			if (!max && SingleCharacter<Inner>::value && RestartableRight<Reference<NearestRight, next>, Right...>::value)
+			{
+				return runMatch<position>(string, move, deep, root, nright, right...);
+			}
+			return greedyMatch<position>(string, move, deep, root, nright, right...);
+		}
+		// cycle over one character: whole run is found at once and continuation is tried from longest one (same result as greedyMatch)
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool runMatch(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			const size_t length{runLength<position>(string, root)};
+			if (root.control && root.control->exceeded) return false;
+			visit(string, root, 0, length);
+			if (length < min) return false;
+			size_t top{length};
+			// cycle which failed one character later already tried continuation everywhere except at shortest end
+			if (root.control && length > min && root.control->failed(Memo<position>::site, string.getPosition() + 1)) top = min;
+			size_t tmp;
+			for (size_t pos{top}; ; --pos)
+			{
+				if (Memo<position, true>::match(string.add(pos), root, [&]{ return nright.match(string.add(pos), tmp = 0, deep+1, root, right...); }))
+				{
+					move += pos + tmp;
+					return true;
+				}
+				Probe<Repeat, position>::backtrack(root);
+				if (pos == min) return false;
+			}
+		}
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool greedyMatch(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			size_t pos{0};
+			ssize_t lastFound{-1};
+			Closure closure;
+			
+			innerContext.save(*this);
+			foundContext.save(*this);
+			AllRightContext<Reference<NearestRight, next>, Right...> allRightContext{nright, right...};
+			
+			size_t tmp;
+			
+			for (unsigned int cycle{0}; ; ++cycle)
+			{
+				visit(string, root, pos, pos);
+				if ((cycle >= min))
+				{
+					if (Memo<position, true>::match(string.add(pos), root, [&]{ return nright.match(string.add(pos), tmp = 0, deep+1, root, right...); }))
+					{
+						allRightContext.remember(nright, right...); 
+						foundContext.save(*this);
+						//nright.getRef().reset(right...);
+						lastFound = pos + tmp;
+						DEBUG_PRINTF(">> found at %zu\n",lastFound);
+					}
+					else
+					{
+						Probe<Repeat, position>::backtrack(root);
+						//printf("\033[1;31mfail: "); AllRightContext<Reference<NearestRight, next>, Right...>::visualize(nright, right...); printf("\033[0m\n");
+					}
+				}
+				// cycle can't be repeated more than max times
+				if (max && cycle == max) break;
+				// in next expression "empty" is needed
+				innerContext.load(*this);
+				if (Inner::template match<position + 1>(string.add(pos), tmp = 0, deep+1, root, makeRef(closure)))
+				{
+					// empty cycle after min cycles would repeat forever (continuation was already tried here)
+					if (!tmp && cycle >= min) break;
+					innerContext.save(*this);
+					pos += tmp;
+				}
+				else break;
+			}
+			// catches of cycles after last found continuation (or of whole failed try) aren't kept
+			foundContext.load(*this);
+			if (lastFound < 0) return false;
+			allRightContext.restore(nright, right...);
+			DEBUG_PRINTF("cycle done (found = %zd)\n",lastFound);
+			move += static_cast<size_t>(lastFound);
+			return true;
+		}
+		// cycle over part which can match more ways, e.g. (a|ab)+c: ends of cycles are searched depth-first in order of preference (more cycles first)
+		// every position is tried once with same count of cycles (count is known only up to min for unbounded cycle, more cycles don't change anything)
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool searchMatch(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			struct Frame
+			{
+				size_t pos;
+				unsigned int cycle;
+				// ends of its cycle are ends[first, last), tried is next of them
+				size_t first;
+				size_t tried;
+				size_t last;
+				bool expanded;
+				// state after cycles which end here
+				Snapshot<Inner> context;
+			};
+			const size_t begin{string.getPosition()};
+			std::deque<Frame> frames;
+			std::vector<size_t> ends;
+			std::vector<std::vector<bool>> reached;
+			auto reach = [&](size_t pos, unsigned int cycle) -> bool {
+				const unsigned int level{(max || cycle < min) ? cycle : min};
+				if (level >= reached.size()) reached.resize(level + 1);
+				std::vector<bool> & row = reached[level];
+				if (pos - begin >= row.size()) row.resize(pos - begin + 1, false);
+				// state with back-reference depends also on catches
+				if (row[pos - begin] && !HasBackReference<Root>::value) return false;
+				row[pos - begin] = true;
+				return true;
+			};
+			const size_t furthest{root.control ? root.control->furthest : 0};
+			if (root.control) root.control->furthest = begin;
+			foundContext.save(*this);
+			frames.emplace_back();
+			frames.back() = {begin, 0, 0, 0, 0, false, {}};
+			frames.back().context.save(*this);
+			reach(begin, 0);
+			bool matched{false};
+			size_t tmp;
+			while (!frames.empty() && !(root.control && root.control->exceeded))
+			{
+				Frame & frame = frames.back();
+				if (!frame.expanded)
+				{
+					frame.expanded = true;
+					visit(string, root, frame.pos - begin, frame.pos - begin);
+					frame.first = frame.tried = ends.size();
+					if (!max || frame.cycle < max)
+					{
+						// ends are collected with remembered failures only when all of them lead to same state (they are tried from every collected end)
+						CycleEnds collect{ends, frame.first};
+						cycleTo<position>(string.add(frame.pos - begin), deep, root, collect, !max && frame.cycle + 1 >= min);
+						frame.context.load(*this);
+					}
+					frame.last = ends.size();
+				}
+				bool deeper{false};
+				while (frame.tried != frame.last && !deeper)
+				{
+					const size_t end{ends[frame.tried++]};
+					// empty cycle doesn't change anything after min cycles
+					if ((end == frame.pos && frame.cycle >= min) || !reach(end, frame.cycle + 1)) continue;
+					frame.context.load(*this);
+					CycleEnd target{end};
+					if (CheckMemory<Inner>::have && !cycleTo<position>(string.add(frame.pos - begin), deep, root, target, false)) continue;
+					frames.emplace_back();
+					frames.back() = {end, frame.cycle + 1, 0, 0, 0, false, {}};
+					frames.back().context.save(*this);
+					deeper = true;
+				}
+				if (deeper) continue;
+				// more cycles didn't help, continuation is tried after cycles which end here
+				if (frame.cycle >= min)
+				{
+					frame.context.load(*this);
+					const size_t pos{frame.pos - begin};
+					if (Memo<position, true>::match(string.add(pos), root, [&]{ return nright.match(string.add(pos), tmp = 0, deep+1, root, right...); }))
+					{
+						move += pos + tmp;
+						matched = true;
+						break;
+					}
+					Probe<Repeat, position>::backtrack(root);
+				}
+				ends.resize(frame.first);
+				frames.pop_back();
+			}
+			if (root.control)
+			{
+				// collected ends weren't tried all, so failures of inner parts are wrong for next try
+				if (matched) root.control->forget(2 * (position + 1), 2 * (position + NodeCount<Inner>::value) + 1, begin, root.control->furthest);
+				root.control->furthest = std::max(furthest, root.control->furthest);
+			}
+			if (!matched) foundContext.load(*this);
+			return matched;
+		}
+		// one cycle with given continuation, failures inside of it are remembered only when memoized
+		template <unsigned int position, typename StringAbstraction, typename Root, typename End> inline bool cycleTo(const StringAbstraction string, unsigned int deep, Root & root, End & end, bool memoized)
+		{
+			size_t tmp{0};
+			if (!root.control) return Inner::template match<position + 1>(string, tmp, deep+1, root, makeRef(end));
+			const bool active{root.control->suspend()};
+			root.control->resume(active && memoized);
+			const bool matched{Inner::template match<position + 1>(string, tmp, deep+1, root, makeRef(end))};
+			root.control->resume(active);
+			return matched;
+		}
+		// consume as many cycles as possible and try continuation just once
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool possessiveMatch(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			size_t pos{0};
+			Closure closure;
+			
+			innerContext.save(*this);
+			foundContext.save(*this);
+			
+			size_t tmp;
+			unsigned int cycle{0};
+			
+			if (SingleCharacter<Inner>::value)
+			{
+				const size_t length{runLength<position>(string, root)};
+				pos = (max && length > max) ? max : length;
+				cycle = static_cast<unsigned int>(pos < min ? pos : min);
+				visit(string, root, 0, pos);
+			}
+			else while ((!max) || (cycle < max))
+			{
+				visit(string, root, pos, pos);
+				if (!Inner::template match<position + 1>(string.add(pos), tmp = 0, deep+1, root, makeRef(closure)))
+				{
+					innerContext.load(*this);
+					break;
+				}
+				innerContext.save(*this);
+				++cycle;
+				// empty cycle can be repeated forever without change
+				if (!tmp)
+				{
+					if (cycle < min) cycle = min;
+					break;
+				}
+				pos += tmp;
+			}
+			if (cycle >= min && Memo<position, true>::match(string.add(pos), root, [&]{ return nright.match(string.add(pos), tmp = 0, deep+1, root, right...); }))
+			{
+				move += pos + tmp;
+				return true;
+			}
+			foundContext.load(*this);
+			return false;
+		}
+		// run of same cycle from position inside of it (or one which reaches it) ends at same place, so every start of match doesn't scan whole run again
+		template <unsigned int position, typename StringAbstraction, typename Root> static inline size_t runLength(const StringAbstraction string, Root & root)
+		{
+			if (!root.control) return string.template run<FirstCharacter<Inner>>();
+			std::pair<size_t, size_t> & known = root.control->run(Memo<position>::site);
+			const size_t begin{string.getPosition()};
+			if (begin >= known.first && begin < known.second) return known.second - begin;
+			size_t end;
+			if (begin < known.first)
+			{
+				size_t length{0};
+				while (begin + length != known.first && string.add(length).template inSet<FirstCharacter<Inner>>()) ++length;
+				end = (begin + length == known.first) ? known.second : begin + length;
+				root.control->charge(length);
+			}
+			else
+			{
+				end = begin + string.template run<FirstCharacter<Inner>>();
+				root.control->charge(end - begin);
+			}
+			known = {begin, end};
+			return end - begin;
+		}
+		template <typename StringAbstraction, typename Root> static inline void visit(const StringAbstraction string, Root & root, size_t from, size_t to)
+		{
+			if (!max && root.control) root.control->visited.emplace_back(string.getPosition() + from, string.getPosition() + to);
+		}
+		inline void reset()
+		{
+			Inner::reset();
+		}
+		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		{
+			return Inner::template getCatch<id>(catches);
+		}
+		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		{
+			return Inner::template getIdentifier<rkey>();
+		}
+		template <bool envelope = true> std::ostream & toString(std::ostream & str) const
+		{
+			if (envelope)
+			{
+				if (min == 1 && max == 0) str << "Plus<";
+				else if (min == 0 && max == 0) str << "Star<";
+				else str << "Repeat<" << min << ',' << max << ',';
+			}
+			if (false) Inner::template toString<false>(str);
+			else Inner::template toString<true>(str);
+			if (envelope) str << ">";
+			return str;
+		}
+	};
+	
+	// cycle which never gives back what it consumed: a{min;max}+ (a++ or a*+)
+	template <unsigned int min, unsigned int max, typename Inner, typename... Rest> struct PossessiveRepeat<min, max, Inner, Rest...>: public PossessiveRepeat<min, max, Seq<Inner,Rest...>> { };
+	
+	template <unsigned int min, unsigned int max, typename Inner> struct PossessiveRepeat<min, max, Inner>: public Repeat<min, max, Inner>
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			const size_t before{move};
+			bool matched;
+			if (!max && root.control) matched = Memo<position>::cycle(string, root, [&]{ return Repeat<min, max, Inner>::template possessiveMatch<position>(string, move, deep, root, nright, right...); });
+			else matched = Repeat<min, max, Inner>::template possessiveMatch<position>(string, move, deep, root, nright, right...);
+			return Probe<PossessiveRepeat, position>::leave(root, matched, move - before);
+		}
+	};
+	
+	// atomic group (?>abc): only first way how inner part matches is used
+	template <typename... Inner> struct Atomic: public Sequence<Inner...>
+	{
+		// state of catches before inner part (scratch space of match)
+		Snapshot<Sequence<Inner...>> context;
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			const size_t before{move};
+			const bool matched{Memo<position>::match(string, root, [&]{ return atomicMatch<position>(string, move, deep, root, nright, right...); })};
+			return Probe<Atomic, position>::leave(root, matched, move - before);
+		}
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool atomicMatch(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			Closure closure;
+			size_t pos{0};
+			context.save(*this);
+			if (!Sequence<Inner...>::template match<position>(string, pos, deep+1, root, makeRef(closure))) return false;
+			size_t tmp{0};
+			if (nright.match(string.add(pos), tmp, deep+1, root, right...))
+			{
+				move += pos + tmp;
+				return true;
+			}
+			// catches inside aren't kept when continuation fails
+			context.load(*this);
+			return false;
+		}
+	};
+	
+	// compile-time description of characters which can begin match of regexp part
+	// nullable: part can match without consuming any character
+	// known: set of first characters is known in compile-time (it's not for back-references)
+	// skippable: positions with character out of the set can be skipped before matching
+	template <bool lnullable, bool lknown> struct FirstCharacterProperties
+	{
+		static const constexpr bool nullable{lnullable};
+		static const constexpr bool known{lknown};
+		static const constexpr bool skippable{lknown && !lnullable};
+	};
+	
+	template <typename T> struct FirstCharacter: FirstCharacterProperties<true, false>
+	{
+		template <typename CharType, CompareFnc<CharType>> static constexpr bool check(const CharType)
+		{
+			return true;
+		}
+	};
+	
+	// zero-width parts
+	template <bool nullable> struct FirstCharacterEmpty: FirstCharacterProperties<nullable, true>
+	{
+		template <typename CharType, CompareFnc<CharType>> static constexpr bool check(const CharType)
+		{
+			return false;
+		}
+	};
+	
+	template <> struct FirstCharacter<Closure>: FirstCharacterEmpty<true> { };
+	template <> struct FirstCharacter<Begin>: FirstCharacterEmpty<true> { };
+	template <> struct FirstCharacter<String<>>: FirstCharacterEmpty<true> { };
+	template <unsigned int key, unsigned int value> struct FirstCharacter<Identifier<key, value>>: FirstCharacterEmpty<true> { };
+	template <> struct FirstCharacter<Selection<>>: FirstCharacterEmpty<false> { };
+	// End matches only at end of input (which is never skipped)
+	template <> struct FirstCharacter<End>: FirstCharacterEmpty<false> { };
+	
+	template <wchar_t firstCode, wchar_t... codes> struct FirstCharacter<String<firstCode, codes...>>: FirstCharacterProperties<false, true>
+	{
+		template <typename CharType, CompareFnc<CharType> compare> static constexpr bool check(const CharType c)
+		{
+			return compare(c, firstCode, firstCode);
+		}
+	};
+	
+	template <bool positive, wchar_t... codes> struct FirstCharacter<CharacterClass<positive, codes...>>: FirstCharacterProperties<false, true>
+	{
+		template <typename CharType, CompareFnc<CharType> compare> static constexpr bool check(const CharType c)
+		{
+			return positive == (sizeof...(codes) == 0 || contains<CharType, compare>(c, codes...));
+		}
+		template <typename CharType, CompareFnc<CharType>> static constexpr bool contains(const CharType)
+		{
+			return false;
+		}
+		template <typename CharType, CompareFnc<CharType> compare, typename... Rest> static constexpr bool contains(const CharType c, const wchar_t code, Rest... rest)
+		{
+			return compare(c, code, code) || contains<CharType, compare>(c, rest...);
+		}
+	};
+	
+	template <bool positive, wchar_t... bounds> struct FirstCharacter<CharacterRange<positive, bounds...>>: FirstCharacterProperties<false, true>
+	{
+		template <typename CharType, CompareFnc<CharType>> static constexpr bool check(const CharType c)
+		{
+			return positive == (sizeof...(bounds) == 0 || contains(c, bounds...));
+		}
+		template <typename CharType> static constexpr bool contains(const CharType)
+		{
+			return false;
+		}
+		template <typename CharType, typename... Rest> static constexpr bool contains(const CharType c, const wchar_t a, const wchar_t b, Rest... rest)
+		{
+			return (c >= a && c <= b) || contains(c, rest...);
+		}
+	};
+	
+	template <> struct FirstCharacter<Sequence<>>: FirstCharacterEmpty<true> { };
+	
+	template <typename First, typename... Rest> struct FirstCharacter<Sequence<First, Rest...>>: FirstCharacterProperties<FirstCharacter<First>::nullable && FirstCharacter<Sequence<Rest...>>::nullable, FirstCharacter<First>::known && (!FirstCharacter<First>::nullable || FirstCharacter<Sequence<Rest...>>::known)>
+	{
+		template <typename CharType, CompareFnc<CharType> compare> static constexpr bool check(const CharType c)
+		{
+			return FirstCharacter<First>::template check<CharType, compare>(c) || (FirstCharacter<First>::nullable && FirstCharacter<Sequence<Rest...>>::template check<CharType, compare>(c));
+		}
+	};
+	
+	template <typename FirstOption, typename... Options> struct FirstCharacter<Selection<FirstOption, Options...>>: FirstCharacterProperties<FirstCharacter<FirstOption>::nullable || FirstCharacter<Selection<Options...>>::nullable, FirstCharacter<FirstOption>::known && FirstCharacter<Selection<Options...>>::known>
+	{
+		template <typename CharType, CompareFnc<CharType> compare> static constexpr bool check(const CharType c)
+		{
+			return FirstCharacter<FirstOption>::template check<CharType, compare>(c) || FirstCharacter<Selection<Options...>>::template check<CharType, compare>(c);
+		}
+	};
+	
+	template <unsigned int min, unsigned int max, typename... Inner> struct FirstCharacter<Repeat<min, max, Inner...>>: FirstCharacterProperties<min == 0 || FirstCharacter<Sequence<Inner...>>::nullable, FirstCharacter<Sequence<Inner...>>::known>
+	{
+		template <typename CharType, CompareFnc<CharType> compare> static constexpr bool check(const CharType c)
+		{
+			return FirstCharacter<Sequence<Inner...>>::template check<CharType, compare>(c);
+		}
+	};
+	
+	template <unsigned int id, typename MemoryType, typename... Inner> struct FirstCharacter<CatchContent<id, MemoryType, Inner...>>: FirstCharacter<Sequence<Inner...>> { };
+	template <unsigned int min, unsigned int max, typename... Inner> struct FirstCharacter<PossessiveRepeat<min, max, Inner...>>: FirstCharacter<Repeat<min, max, Inner...>> { };
+	template <typename... Inner> struct FirstCharacter<Atomic<Inner...>>: FirstCharacter<Sequence<Inner...>> { };
+	
+	// parts of right context (see Repeat)
+	template <typename T, unsigned int position> struct FirstCharacter<Reference<T, position>>: FirstCharacter<T> { };
+	template <unsigned int id, typename MemoryType> struct FirstCharacter<XMark<id, MemoryType>>: FirstCharacterEmpty<true> { };
+	
+	// regexp which begins with Begin (in every option) is tried only at first position
+	template <typename T> struct AnchoredAtBegin: std::false_type { };
+	template <> struct AnchoredAtBegin<Begin>: std::true_type { };
+	template <typename First, typename... Rest> struct AnchoredAtBegin<Sequence<First, Rest...>>: AnchoredAtBegin<First> { };
+	template <unsigned int key, unsigned int value, typename... Rest> struct AnchoredAtBegin<Sequence<Identifier<key, value>, Rest...>>: AnchoredAtBegin<Sequence<Rest...>> { };
+	template <typename FirstOption> struct AnchoredAtBegin<Selection<FirstOption>>: AnchoredAtBegin<FirstOption> { };
+	template <typename FirstOption, typename... Options> struct AnchoredAtBegin<Selection<FirstOption, Options...>>: std::integral_constant<bool, AnchoredAtBegin<FirstOption>::value && AnchoredAtBegin<Selection<Options...>>::value> { };
+	template <unsigned int id, typename MemoryType, typename... Inner> struct AnchoredAtBegin<CatchContent<id, MemoryType, Inner...>>: AnchoredAtBegin<Sequence<Inner...>> { };
+	template <typename... Inner> struct AnchoredAtBegin<Atomic<Inner...>>: AnchoredAtBegin<Sequence<Inner...>> { };
+	
+	// literal which begins every match (Type is CodeList), complete: part is only that literal, so literal can continue with rest of sequence
+	template <typename A, typename B> struct ConcatCodes;
+	template <wchar_t... a, wchar_t... b> struct ConcatCodes<CodeList<a...>, CodeList<b...>>
+	{
+		using Type = CodeList<a..., b...>;
+	};
+	
+	template <typename T> struct LiteralPrefix
+	{
+		using Type = CodeList<>;
+		static const constexpr bool complete{false};
+	};
+	template <wchar_t... codes> struct LiteralPrefix<String<codes...>>
+	{
+		using Type = CodeList<codes...>;
+		static const constexpr bool complete{true};
+	};
+	template <wchar_t code> struct LiteralPrefix<CharacterClass<true, code>>: LiteralPrefix<String<code>> { };
+	template <unsigned int key, unsigned int value> struct LiteralPrefix<Identifier<key, value>>
+	{
+		using Type = CodeList<>;
+		static const constexpr bool complete{true};
+	};
+	template <> struct LiteralPrefix<Sequence<>>: LiteralPrefix<String<>> { };
+	template <typename First, typename... Rest> struct LiteralPrefix<Sequence<First, Rest...>>
+	{
+		using Type = typename std::conditional<LiteralPrefix<First>::complete, typename ConcatCodes<typename LiteralPrefix<First>::Type, typename LiteralPrefix<Sequence<Rest...>>::Type>::Type, typename LiteralPrefix<First>::Type>::type;
+		static const constexpr bool complete{LiteralPrefix<First>::complete && LiteralPrefix<Sequence<Rest...>>::complete};
+	};
+	template <unsigned int id, typename MemoryType, typename... Inner> struct LiteralPrefix<CatchContent<id, MemoryType, Inner...>>: LiteralPrefix<Sequence<Inner...>> { };
+	template <typename... Inner> struct LiteralPrefix<Atomic<Inner...>>: LiteralPrefix<Sequence<Inner...>> { };
+	template <unsigned int min, unsigned int max, typename... Inner> struct LiteralPrefix<Repeat<min, max, Inner...>>
+	{
+		using Type = typename std::conditional<(min > 0), typename LiteralPrefix<Sequence<Inner...>>::Type, CodeList<>>::type;
+		static const constexpr bool complete{false};
+	};
+	template <unsigned int min, unsigned int max, typename... Inner> struct LiteralPrefix<PossessiveRepeat<min, max, Inner...>>: LiteralPrefix<Repeat<min, max, Inner...>> { };
+	
+	// longest literal which every match contains somewhere (Type is CodeList), input without it can't match
+	template <typename A, typename B> struct LongerCodes;
+	template <wchar_t... a, wchar_t... b> struct LongerCodes<CodeList<a...>, CodeList<b...>>
+	{
+		using Type = typename std::conditional<(sizeof...(a) >= sizeof...(b)), CodeList<a...>, CodeList<b...>>::type;
+	};
+	
+	template <typename T> struct RequiredLiteral
+	{
+		using Type = typename LiteralPrefix<T>::Type;
+	};
+	
+	// complete parts of sequence are joined into current literal, other part ends it (only its prefix can continue current literal)
+	template <typename Current, typename Best, typename... Parts> struct RequiredInSequence
+	{
+		using Type = typename LongerCodes<Current, Best>::Type;
+	};
+	template <typename Current, typename Best, typename First, typename... Rest> struct RequiredInSequence<Current, Best, First, Rest...>
+	{
+		using Joined = typename ConcatCodes<Current, typename LiteralPrefix<First>::Type>::Type;
+		using Found = typename LongerCodes<typename LongerCodes<Best, Joined>::Type, typename RequiredLiteral<First>::Type>::Type;
+		using Type = typename std::conditional<LiteralPrefix<First>::complete, RequiredInSequence<Joined, Best, Rest...>, RequiredInSequence<CodeList<>, Found, Rest...>>::type::Type;
+	};
+	
+	template <typename... Parts> struct RequiredLiteral<Sequence<Parts...>>: RequiredInSequence<CodeList<>, CodeList<>, Parts...> { };
+	template <typename... Options> struct RequiredLiteral<Selection<Options...>>
+	{
+		using Type = CodeList<>;
+	};
+	template <unsigned int id, typename MemoryType, typename... Inner> struct RequiredLiteral<CatchContent<id, MemoryType, Inner...>>: RequiredLiteral<Sequence<Inner...>> { };
+	template <typename... Inner> struct RequiredLiteral<Atomic<Inner...>>: RequiredLiteral<Sequence<Inner...>> { };
+	template <unsigned int min, unsigned int max, typename... Inner> struct RequiredLiteral<Repeat<min, max, Inner...>>
+	{
+		using Type = typename std::conditional<(min > 0), typename RequiredLiteral<Sequence<Inner...>>::Type, CodeList<>>::type;
+	};
+	template <unsigned int min, unsigned int max, typename... Inner> struct RequiredLiteral<PossessiveRepeat<min, max, Inner...>>: RequiredLiteral<Repeat<min, max, Inner...>> { };
+	
+	template <typename T> struct SetLiteral<FirstCharacter<T>>
+	{
+		using Type = typename LiteralPrefix<T>::Type;
+	};
+	
+	// lowering of regexp without catches (and identifiers) into Thompson NFA
+	// every build function gets state of continuation and returns entry state
+	template <typename T> struct NFABuilder
+	{
+		static const constexpr bool supported{false};
+	};
+	
+	template <typename T> struct NFACharacterBuilder
+	{
+		static const constexpr bool supported{true};
+		template <CompareFnc<char> compare> static unsigned int build(NFA & nfa, unsigned int next)
+		{
+			return nfa.addCharacter(ByteTable<FirstCharacterPredicate<FirstCharacter<T>, char, compare>>::data, next);
+		}
+	};
+	
+	template <bool positive, wchar_t... codes> struct NFABuilder<CharacterClass<positive, codes...>>: NFACharacterBuilder<CharacterClass<positive, codes...>> { };
+	template <bool positive, wchar_t... bounds> struct NFABuilder<CharacterRange<positive, bounds...>>: NFACharacterBuilder<CharacterRange<positive, bounds...>> { };
+	
+	template <wchar_t firstCode, wchar_t... codes> struct NFABuilder<String<firstCode, codes...>>
+	{
+		static const constexpr bool supported{true};
+		template <CompareFnc<char> compare> static unsigned int build(NFA & nfa, unsigned int next)
+		{
+			return NFACharacterBuilder<String<firstCode>>::template build<compare>(nfa, NFABuilder<String<codes...>>::template build<compare>(nfa, next));
+		}
+	};
+	
+	template <> struct NFABuilder<String<>>
+	{
+		static const constexpr bool supported{true};
+		template <CompareFnc<char>> static unsigned int build(NFA &, unsigned int next)
+		{
+			return next;
+		}
+	};
+	
+	template <> struct NFABuilder<Begin>
+	{
+		static const constexpr bool supported{true};
+		template <CompareFnc<char>> static unsigned int build(NFA & nfa, unsigned int next)
+		{
+			return nfa.add(NFAState::Type::Begin, next);
+		}
+	};
+	
+	template <> struct NFABuilder<End>
+	{
+		static const constexpr bool supported{true};
+		template <CompareFnc<char>> static unsigned int build(NFA & nfa, unsigned int next)
+		{
+			return nfa.add(NFAState::Type::End, next);
+		}
+	};
+	
+	template <> struct NFABuilder<Sequence<>>: NFABuilder<String<>> { };
+	
+	template <typename First, typename... Rest> struct NFABuilder<Sequence<First, Rest...>>
+	{
+		static const constexpr bool supported{NFABuilder<First>::supported && NFABuilder<Sequence<Rest...>>::supported};
+		template <CompareFnc<char> compare> static unsigned int build(NFA & nfa, unsigned int next)
+		{
+			return NFABuilder<First>::template build<compare>(nfa, NFABuilder<Sequence<Rest...>>::template build<compare>(nfa, next));
+		}
+	};
+	
+	template <> struct NFABuilder<Selection<>>
+	{
+		static const constexpr bool supported{true};
+		template <CompareFnc<char>> static unsigned int build(NFA & nfa, unsigned int)
+		{
+			return nfa.addFail();
+		}
+	};
+	
+	template <typename FirstOption, typename... Options> struct NFABuilder<Selection<FirstOption, Options...>>
+	{
+		static const constexpr bool supported{NFABuilder<FirstOption>::supported && NFABuilder<Selection<Options...>>::supported};
+		template <CompareFnc<char> compare> static unsigned int build(NFA & nfa, unsigned int next)
+		{
+			if (sizeof...(Options) == 0) return NFABuilder<FirstOption>::template build<compare>(nfa, next);
+			const unsigned int first{NFABuilder<FirstOption>::template build<compare>(nfa, next)};
+			return nfa.addSplit(first, NFABuilder<Selection<Options...>>::template build<compare>(nfa, next));
+		}
+	};
+	
+	// repeat is unrolled: min mandatory copies followed by loop (max = 0) or (max - min) optional copies
+	template <unsigned int min, unsigned int max, typename... Inner> struct NFABuilder<Repeat<min, max, Inner...>>
+	{
+		static const constexpr bool supported{NFABuilder<Sequence<Inner...>>::supported};
+		template <CompareFnc<char> compare> static unsigned int build(NFA & nfa, unsigned int next)
+		{
+			unsigned int entry{next};
+			if (max == 0)
+			{
+				entry = nfa.addSplit(0, next);
+				const unsigned int inner{NFABuilder<Sequence<Inner...>>::template build<compare>(nfa, entry)};
+				nfa.states[entry].out1 = inner;
+			}
+			else for (unsigned int i{min}; i < max; ++i)
+			{
+				entry = nfa.addSplit(NFABuilder<Sequence<Inner...>>::template build<compare>(nfa, entry), next);
+			}
+			for (unsigned int i{0}; i < min; ++i)
+			{
+				entry = NFABuilder<Sequence<Inner...>>::template build<compare>(nfa, entry);
+			}
+			return entry;
+		}
+	};
+	
+	template <typename T, CompareFnc<char> compare> NFA buildNFA()
+	{
+		NFA nfa;
+		nfa.start = NFABuilder<T>::template build<compare>(nfa, nfa.addMatch());
+		return nfa;
+	}
+	
+	// more patterns in one automaton, every pattern has own match state (with its index)
+	template <typename... Patterns> struct NFAPatternsBuilder
+	{
+		template <CompareFnc<char>> static unsigned int build(NFA & nfa, unsigned int)
+		{
+			return nfa.addFail();
+		}
+	};
+	
+	template <typename First, typename... Rest> struct NFAPatternsBuilder<First, Rest...>
+	{
+		template <CompareFnc<char> compare> static unsigned int build(NFA & nfa, unsigned int index)
+		{
+			nfa.pattern = index;
+			const unsigned int first{NFABuilder<First>::template build<compare>(nfa, nfa.addMatch())};
+			if (sizeof...(Rest) == 0) return first;
+			return nfa.addSplit(first, NFAPatternsBuilder<Rest...>::template build<compare>(nfa, index + 1));
+		}
+	};
+	
+		// wrapper for floating matching in string (begin regexp anywhere in string)
+	// without Eat<...> is regexp ABC equivalent to ^ABC$
+	template <typename... Inner> struct Eat: public Sequence<Inner...>
+	{
+		// span of last found match (positions from begin of input)
+		size_t matchBegin{0};
+		size_t matchEnd{0};
+		// span is known only after successful backtracking (not after DFA)
+		bool spanFound{false};
+		// limits of bounded backtracking (when used)
+		Backtracking * control{nullptr};
+		#ifdef SRX_PROFILE
+		// counters of nodes (they aren't cleared with reset)
+		Profile profile;
+		#endif
+		// storage of catches with ArenaMemory
+		CatchArena arena;
+		Eat() = default;
+		Eat(const Eat & orig): Sequence<Inner...>(orig), matchBegin{orig.matchBegin}, matchEnd{orig.matchEnd}, spanFound{orig.spanFound}, control{orig.control}
+		{
+			#ifdef SRX_PROFILE
+			profile = orig.profile;
+			#endif
+			forgetArena();
+		}
+		Eat & operator=(const Eat & orig)
+		{
+			Sequence<Inner...>::operator=(orig);
+			matchBegin = orig.matchBegin;
+			matchEnd = orig.matchEnd;
+			spanFound = orig.spanFound;
+			control = orig.control;
+			#ifdef SRX_PROFILE
+			profile = orig.profile;
+			#endif
+			forgetArena();
+			return *this;
+		}
+		// catches in arena of original aren't copied
+		inline void forgetArena()
+		{
+			if (UsesArena<Eat>::value) reset();
+		}
+		// root is first node of pattern
+		template <typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			const bool matched{eat(string, move, deep, root, nright, right...)};
+			spanFound = matched;
+			return Probe<Eat, 0>::leave(root, matched, matchEnd - matchBegin);
+		}
+		template <typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool eat(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			size_t pos{0};
+			
+			if (AnchoredAtBegin<Sequence<Inner...>>::value)
+			{
+				// Begin would fail at every other position
+				if (!string.isBegin() || !Sequence<Inner...>::template match<0>(string, pos, deep+1, root, nright, right...)) return false;
+				matchBegin = string.getPosition();
+				matchEnd = matchBegin + pos;
+				move += pos;
+				return true;
+			}
+			else if (!string.exists() && Sequence<Inner...>::template match<0>(string, move, deep+1, root, nright, right...))
+			{
+				// branch just for empty strings
+				matchBegin = matchEnd = string.getPosition();
+				return true;
+			}
+			else while (string.exists(pos = string.template skip<FirstCharacter<Sequence<Inner...>>>(pos))) {
+				// positions which can't be begin of match are skipped
+				if (control && control->exceeded) return false;
+				size_t imove{0};
+				//DEBUG_PRINTF("eating... (pos = %zu)\n",pos);
+				if (Sequence<Inner...>::template match<0>(string.add(pos), imove, deep+1, root, nright, right...))
+				{
+					matchBegin = string.getPosition() + pos;
+					matchEnd = matchBegin + imove;
+					move += pos + imove;
+					return true;
+				}
+				else
+				{
+					Probe<Eat, 0>::backtrack(root);
+					pos++;
+				}
+			}
+			return false;
+		}
+		inline void reset()
+		{
+			Sequence<Inner...>::reset();
+			arena.reset();
+			matchBegin = matchEnd = 0;
+			spanFound = false;
+		}
+		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		{
+			return Sequence<Inner...>::template getCatch<id>(catches);
+		}
+		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		{
+			return Sequence<Inner...>::template getIdentifier<rkey>();
+		}
+	};
+	
+	// debug template
+	template <unsigned int part, typename... Inner> struct Debug: Sequence<Inner...>
+	{
+		template <unsigned int position, typename StringAbstraction, typename Root, typename NearestRight, unsigned int next, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight, next> nright, Right... right)
+		{
+			if (Sequence<Inner...>::template match<position>(string, move, deep, root, nright, right...))
+			{
+				std::cout << "[part "<<part<<": match; pos="<<string.getPosition()<<"; move="<<move<<"; right="<<sizeof...(Right)<<"]\n";
+				return true;
+			}
+			else
+			{
+				std::cout << "[part "<<part<<": no match; pos="<<string.getPosition()<<"; move="<<move<<"; right="<<sizeof...(Right)<<"]\n";
+				return false;
+			}
+		}
+		inline void reset()
+		{
+			Sequence<Inner...>::reset();
+		}
+		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		{
+			return Sequence<Inner...>::template getCatch<id>(catches);
+		}
+		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		{
+			return Sequence<Inner...>::template getIdentifier<rkey>();
+		}
+	};
+	
+	// templated struct which contains regular expression and is used be user :)
+	template <typename... Definition> struct RegularExpression
+	{
+		// state of matching, catches have storage sized from pattern (see SizedCatches)
+		using State = Eat<typename SizedCatches<Definition, 1>::Type...>;
+		State eat;
+		// regexp without catches and identifiers is matched with DFA in linear time
+		static const constexpr bool deterministic{NFABuilder<Sequence<Definition...>>::supported};
+		using Results = MatchResults<RegularExpression>;
+		template <CompareFnc<char> compare = charactersAreEqual<char>> using Stream = MatchStream<RegularExpression, compare>;
+	protected:
+		template <typename, CompareFnc<char>> friend struct MatchStream;
+		template <typename, CompareFnc<char>> friend struct MatchIterator;
+		using Deterministic = std::integral_constant<bool, deterministic>;
+		template <CompareFnc<char> compare> static const DFA & getDFA()
+		{
+			static const DFA dfa{buildNFA<Sequence<Definition...>, compare>()};
+			return dfa;
+		}
+		// state contains catches and identifiers, it's regexp itself or external results
+		// DFA doesn't know where match begins, so span is found with backtracking (only in input which matches)
+		// input is first searched for required literal (when it isn't already searched as prefix)
+		template <CompareFnc<char> compare> using Required = CharacterLiteral<compare, typename RequiredLiteral<Sequence<Definition...>>::Type>;
+		template <CompareFnc<char> compare> static inline bool containsRequired(const char * begin, const char * end)
+		{
+			if (Required<compare>::length < 3 || CharacterLiteral<compare, typename LiteralPrefix<Sequence<Definition...>>::Type>::length >= 3 || AnchoredAtBegin<Sequence<Definition...>>::value) return true;
+			return static_cast<size_t>(end - FindLiteral<Required<compare>>::find(begin, end)) >= Required<compare>::length;
+		}
+		template <CompareFnc<char> compare> static inline bool containsRequired(const CharacterAbstraction<char, compare> string)
+		{
+			return Required<compare>::length < 3 || containsRequired<compare>(string.str, string.str + strlen(string.str));
+		}
+		template <CompareFnc<char> compare> static inline bool containsRequired(const BoundedCharacterAbstraction<char, compare> string)
+		{
+			return containsRequired<compare>(string.str, string.last);
+		}
+		// catches and span of previous match aren't kept (also when input is rejected or matched only with DFA, then span is empty)
+		template <CompareFnc<char> compare, bool span, typename StringAbstraction> inline bool search(const StringAbstraction string, State & state, std::true_type) const
+		{
+			state.reset();
+			if (!containsRequired<compare>(string)) return false;
+			const DFA & dfa = getDFA<compare>();
+			if (!dfa.valid) return run(string, state);
+			if (!dfa.template search<FirstCharacter<Sequence<Definition...>>>(string)) return false;
+			return !span || run(string, state);
+		}
+		template <CompareFnc<char> compare, bool, typename StringAbstraction> inline bool search(const StringAbstraction string, State & state, std::false_type) const
+		{
+			state.reset();
+			return containsRequired<compare>(string) && run(string, state);
+		}
+		template <typename StringAbstraction> inline bool backtrack(const StringAbstraction string, State & state) const
+		{
+			// catches of previous match aren't kept
+			state.reset();
+			return run(string, state);
+		}
+		template <typename StringAbstraction> inline bool run(const StringAbstraction string, State & state) const
+		{
+			size_t pos{0};
+			Closure closure;
+			return state.match(string, pos, 0, state, makeRef(closure));
+		}
+		template <CompareFnc<char> compare, typename StringAbstraction> inline MatchStatus bounded(const StringAbstraction string, State & state, Backtracking & limits) const
+		{
+			limits.prepare(!HasBackReference<Sequence<Definition...>>::value);
+			state.control = &limits;
+			const bool found{search<compare, true>(string, state, Deterministic{})};
+			state.control = nullptr;
+			if (limits.exceeded) return MatchStatus::BudgetExceeded;
+			return found ? MatchStatus::Match : MatchStatus::NoMatch;
+		}
+	public:
+		void reset()
+		{
+			eat.reset();
+		}
+		#ifdef SRX_PROFILE
+		// counters of nodes from all matching with this regexp (see Profile)
+		const Profile & profile() const
+		{
+			return eat.profile;
+		}
+		#endif
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const std::string & string)
+		{
+			return operator()<compare>(string.data(), string.data() + string.size());
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const char * string)
+		{
+			return search<compare, false>(StringAbstraction<const char *, const char, compare>(string), eat, Deterministic{});
+		}
+		// length-delimited input (without terminating NUL)
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const char * begin, const char * end)
+		{
+			return search<compare, false>(BoundedCharacterAbstraction<char, compare>(begin, end), eat, Deterministic{});
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const char * string, size_t length)
+		{
+			return operator()<compare>(string, string + length);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool operator()(const std::wstring & string)
+		{
+			return operator()<compare>(string.data(), string.data() + string.size());
+		}
+		template <CompareFnc<wchar_t> compare =  charactersAreEqual<wchar_t>> inline bool operator()(const wchar_t * string)
+		{
+			return backtrack(StringAbstraction<const wchar_t *, const wchar_t, compare>(string), eat);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool operator()(const wchar_t * begin, const wchar_t * end)
+		{
+			return backtrack(BoundedCharacterAbstraction<wchar_t, compare>(begin, end), eat);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool operator()(const wchar_t * string, size_t length)
+		{
+			return operator()<compare>(string, string + length);
+		}
+		#if __cplusplus >= 201703L
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(std::string_view string)
+		{
+			return operator()<compare>(string.data(), string.data() + string.size());
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool operator()(std::wstring_view string)
+		{
+			return operator()<compare>(string.data(), string.data() + string.size());
+		}
+		#endif
+		// same as operator() but span of match is known also for regexp matched with DFA
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const std::string & string)
+		{
+			return match<compare>(string.data(), string.data() + string.size());
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string)
+		{
+			return search<compare, true>(StringAbstraction<const char *, const char, compare>(string), eat, Deterministic{});
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * begin, const char * end)
+		{
+			return search<compare, true>(BoundedCharacterAbstraction<char, compare>(begin, end), eat, Deterministic{});
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string, size_t length)
+		{
+			return match<compare>(string, string + length);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const std::wstring & string)
+		{
+			return operator()<compare>(string);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const wchar_t * string)
+		{
+			return operator()<compare>(string);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const wchar_t * begin, const wchar_t * end)
+		{
+			return operator()<compare>(begin, end);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const wchar_t * string, size_t length)
+		{
+			return operator()<compare>(string, length);
+		}
+		#if __cplusplus >= 201703L
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(std::string_view string)
+		{
+			return match<compare>(string.data(), string.data() + string.size());
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(std::wstring_view string)
+		{
+			return operator()<compare>(string);
+		}
+		#endif
+		// bounded backtracking (see Backtracking), it's known when budget was exceeded
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchStatus match(const std::string & string, Backtracking & limits)
+		{
+			return match<compare>(string.data(), string.data() + string.size(), limits);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchStatus match(const char * string, Backtracking & limits)
+		{
+			return bounded<compare>(StringAbstraction<const char *, const char, compare>(string), eat, limits);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchStatus match(const char * begin, const char * end, Backtracking & limits)
+		{
+			return bounded<compare>(BoundedCharacterAbstraction<char, compare>(begin, end), eat, limits);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchStatus match(const char * string, size_t length, Backtracking & limits)
+		{
+			return match<compare>(string, string + length, limits);
+		}
+		// const (thread-safe) matching, catches and identifiers are stored in results
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string, Results & results) const
+		{
+			return search<compare, true>(StringAbstraction<const char *, const char, compare>(string), results.eat, Deterministic{});
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * begin, const char * end, Results & results) const
+		{
+			return search<compare, true>(BoundedCharacterAbstraction<char, compare>(begin, end), results.eat, Deterministic{});
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string, size_t length, Results & results) const
+		{
+			return match<compare>(string, string + length, results);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const std::string & string, Results & results) const
+		{
+			return match<compare>(string.data(), string.data() + string.size(), results);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchStatus match(const char * begin, const char * end, Results & results, Backtracking & limits) const
+		{
+			return bounded<compare>(BoundedCharacterAbstraction<char, compare>(begin, end), results.eat, limits);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchStatus match(const std::string & string, Results & results, Backtracking & limits) const
+		{
+			return match<compare>(string.data(), string.data() + string.size(), results, limits);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const wchar_t * string, Results & results) const
+		{
+			return backtrack(StringAbstraction<const wchar_t *, const wchar_t, compare>(string), results.eat);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const wchar_t * begin, const wchar_t * end, Results & results) const
+		{
+			return backtrack(BoundedCharacterAbstraction<wchar_t, compare>(begin, end), results.eat);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const wchar_t * string, size_t length, Results & results) const
+		{
+			return match<compare>(string, string + length, results);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const std::wstring & string, Results & results) const
+		{
+			return match<compare>(string.data(), string.data() + string.size(), results);
+		}
+		#if __cplusplus >= 201703L
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(std::string_view string, Results & results) const
+		{
+			return match<compare>(string.data(), string.data() + string.size(), results);
+		}
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(std::wstring_view string, Results & results) const
+		{
+			return match<compare>(string.data(), string.data() + string.size(), results);
+		}
+		#endif
+		// all non-overlapping matches with their span and catches (input must outlive iteration)
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchRange<RegularExpression, compare> findAll(const char * begin, const char * end) const
+		{
+			return {begin, end};
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchRange<RegularExpression, compare> findAll(const char * string, size_t length) const
+		{
+			return {string, string + length};
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchRange<RegularExpression, compare> findAll(const char * string) const
+		{
+			return {string, string + strlen(string)};
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchRange<RegularExpression, compare> findAll(const std::string & string) const
+		{
+			return {string.data(), string.data() + string.size()};
+		}
+		#if __cplusplus >= 201703L
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline MatchRange<RegularExpression, compare> findAll(std::string_view string) const
+		{
+			return {string.data(), string.data() + string.size()};
+		}
+		#endif
+		template <unsigned int key> unsigned int getIdentifier()
+		{
+			return eat.template getIdentifier<key>();
 		}
-		template <unsigned int> inline bool getCatch(CatchReturn &) const
+		template <unsigned int id> inline CatchReturn getCatch()
 		{
-			return false;
+			CatchReturn catches;
+			eat.template getCatch<id>(catches);
+			return catches;
 		}
-		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		template <unsigned int id, typename StringType> inline auto part(const StringType string, unsigned int subid = 0) -> decltype(string)
 		{
-			return matched ? (key == rkey ? value : 0) : 0;
+			return string.substr(getCatch<id>()[subid].begin, getCatch<id>()[subid].length);
 		}
-	};
-	
-	// temlated struct which represent selection in regexp (a|b|c)
-	template <typename FirstOption, typename... Options> struct Selection<FirstOption, Options...>: public FirstOption
-	{
-		Selection<Options...> rest;
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		// operator() of deterministic regexp finds match with DFA only, span (and catches) are known only after match()
+		bool hasSpan() const
 		{
-			if (FirstOption::match(string, move, deep+1, root, nright, right...))
-			{
-				return true;
-			}
-			else
-			{
-				//FirstOption::reset(nright, right...);
-				return rest.match(string, move, deep+1, root, nright, right...);
-			}
+			return eat.spanFound;
 		}
-		inline void reset()
+		// span of whole match (empty without hasSpan())
+		size_t position() const
 		{
-			FirstOption::reset();
-			rest.reset();
+			return eat.matchBegin;
 		}
-		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		size_t length() const
 		{
-			return FirstOption::template getCatch<id>(catches) || rest.template getCatch<id>(catches);
+			return eat.matchEnd - eat.matchBegin;
 		}
-		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		template <typename StringType> inline auto whole(const StringType string) const -> decltype(string)
 		{
-			if (FirstOption::template getIdentifier<rkey>()) return FirstOption::template getIdentifier<rkey>();
-			else return rest.template getIdentifier<rkey>();
+			return string.substr(position(), length());
 		}
 	};
 	
-	// empty selection always fail
-	template <> struct Selection<>
+	// result of const matching (catches and identifiers), every thread can have own results and share regexp
+	template <typename... Definition> struct MatchResults<RegularExpression<Definition...>>
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction, size_t &, unsigned int, Root &, Reference<NearestRight>, Right...)
+		// state of matching has same layout as regexp
+		typename RegularExpression<Definition...>::State eat;
+		void reset()
 		{
-			return false;
+			eat.reset();
 		}
-		inline void reset() {}
-		template <unsigned int> inline bool getCatch(CatchReturn &) const 
+		#ifdef SRX_PROFILE
+		const Profile & profile() const
 		{
-			return false;
+			return eat.profile;
 		}
-		template <unsigned int> inline unsigned int getIdentifier() const
+		#endif
+		template <unsigned int key> unsigned int getIdentifier() const
 		{
-			return 0;
+			return eat.template getIdentifier<key>();
 		}
-	};
-	
-	// templated struct which represent sequence of another regexps 
-	template <typename First, typename... Rest> struct Sequence<First, Rest...>: public First
-	{
-		Sequence<Rest...> rest;
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		template <unsigned int id> inline CatchReturn getCatch() const
 		{
-			if (First::match(string, move, deep, root, makeRef(rest), nright, right...))
-			{
-				return true;
-			}
-			//First::reset(nright, right...);
-			return false;
+			CatchReturn catches;
+			eat.template getCatch<id>(catches);
+			return catches;
 		}
-		inline void reset()
+		template <unsigned int id, typename StringType> inline auto part(const StringType string, unsigned int subid = 0) const -> decltype(string)
 		{
-			First::reset();
-			rest.reset();
+			return string.substr(getCatch<id>()[subid].begin, getCatch<id>()[subid].length);
 		}
-		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		// span of whole match
+		size_t position() const
 		{
-			return First::template getCatch<id>(catches) || rest.template getCatch<id>(catches);
+			return eat.matchBegin;
 		}
-		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		size_t length() const
 		{
-			if (First::template getIdentifier<rkey>()) return First::template getIdentifier<rkey>();
-			else return rest.template getIdentifier<rkey>();
+			return eat.matchEnd - eat.matchBegin;
+		}
+		template <typename StringType> inline auto whole(const StringType string) const -> decltype(string)
+		{
+			return string.substr(position(), length());
 		}
 	};
-
-	// sequence of just one inner regexp
-	template <typename First> struct Sequence<First>: public First
+	
+	// iterator over non-overlapping matches, scanning continues at end of previous match (after empty match one character later)
+	template <typename... Definition, CompareFnc<char> compare> struct MatchIterator<RegularExpression<Definition...>, compare>
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		using Regexp = RegularExpression<Definition...>;
+		using Results = typename Regexp::Results;
+		using iterator_category = std::input_iterator_tag;
+		using value_type = Results;
+		using difference_type = ptrdiff_t;
+		using pointer = const Results *;
+		using reference = const Results &;
+	protected:
+		const char * first{nullptr};
+		const char * last{nullptr};
+		size_t next{0};
+		bool done{true};
+		Results results;
+		// DFA can quickly tell there is no other match
+		bool possible(const BoundedCharacterAbstraction<char, compare> rest, std::true_type) const
+		{
+			if (!Regexp::template containsRequired<compare>(rest)) return false;
+			const DFA & dfa = Regexp::template getDFA<compare>();
+			if (!dfa.valid || !rest.exists()) return true;
+			// Begin can't match anymore after first position
+			unsigned int state{next ? dfa.idle : dfa.initial};
+			size_t pos{0};
+			return dfa.template resume<FirstCharacter<Sequence<Definition...>>>(rest, state, pos) || dfa.acceptAtEnd[state];
+		}
+		bool possible(const BoundedCharacterAbstraction<char, compare> rest, std::false_type) const
 		{
-			if (First::match(string, move, deep, root, nright, right...))
-			{
-				return true;
-			}
-			//First::reset(nright, right...);
-			return false;
+			return Regexp::template containsRequired<compare>(rest);
 		}
-		inline void reset()
+		void find()
 		{
-			First::reset();
+			results.reset();
+			const BoundedCharacterAbstraction<char, compare> string{first, last};
+			if (next > static_cast<size_t>(last - first) || !possible(string.add(next), std::integral_constant<bool, Regexp::deterministic>{}))
+			{
+				done = true;
+				return;
+			}
+			size_t move{0};
+			Closure closure;
+			if (!results.eat.match(string.add(next), move, 0, results.eat, makeRef(closure)))
+			{
+				done = true;
+				return;
+			}
+			next = results.eat.matchEnd + (results.length() ? 0 : 1);
 		}
-		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+	public:
+		// end of matches
+		MatchIterator() = default;
+		MatchIterator(const char * begin, const char * end): first{begin}, last{end}, done{false}
 		{
-			return First::template getCatch<id>(catches);
+			find();
 		}
-		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		reference operator*() const
 		{
-			return First::template getIdentifier<rkey>();
+			return results;
 		}
-	};
-	
-	// templated struct which represents generic-loop with min,max limit
-	// ()+ "plus" cycle have min 1 and min 0 (infinity)
-	// ()* "star" cycle have min 0 and max 0 (infinity)
-	template <unsigned int min, unsigned int max, typename Inner, typename... Rest> struct Repeat<min, max, Inner, Rest...>: public Repeat<min, max, Seq<Inner,Rest...>>
-	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		pointer operator->() const
 		{
-			return Repeat<min, max, Seq<Inner,Rest...>>::match(string, move, deep, root, nright, right...);
+			return &results;
 		}
-		inline void reset()
+		MatchIterator & operator++()
 		{
-			Repeat<min, max, Seq<Inner,Rest...>>::reset();
+			find();
+			return *this;
 		}
-		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		bool operator==(const MatchIterator & other) const
 		{
-			return Repeat<min, max, Seq<Inner,Rest...>>::template getCatch<id>(catches);
+			return (done && other.done) || (!done && !other.done && first == other.first && next == other.next);
 		}
-		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		bool operator!=(const MatchIterator & other) const
 		{
-			return Repeat<min, max, Seq<Inner,Rest...>>::template getIdentifier<rkey>();
+			return !(*this == other);
 		}
 	};
 	
-	// cycle with just one inner regexp
-	
-	struct RepeatCounter
+	// input must live while matches are used
+	template <typename... Definition, CompareFnc<char> compare> struct MatchRange<RegularExpression<Definition...>, compare>
 	{
-		static unsigned int getID()
+		const char * first;
+		const char * last;
+		MatchIterator<RegularExpression<Definition...>, compare> begin() const
+		{
+			return {first, last};
+		}
+		MatchIterator<RegularExpression<Definition...>, compare> end() const
 		{
-			static unsigned int id = 0;
-			return ++id;
+			return {};
 		}
 	};
 	
-	template <unsigned int min, unsigned int max, typename Inner> struct Repeat<min, max, Inner>: public Inner
+	// input in pieces (e.g. from network), automaton state is kept between them so input doesn't need to be in memory
+	// offsets are relative to begin of stream, match is reported at position where it ends
+	template <typename... Definition, CompareFnc<char> compare> struct MatchStream<RegularExpression<Definition...>, compare>
 	{
-		unsigned int id{0};
-		Repeat(): id{RepeatCounter::getID()}
+		static_assert(RegularExpression<Definition...>::deterministic, "only regexp without catches and identifiers can be matched in stream");
+	protected:
+		const DFA & dfa;
+		unsigned int state;
+		uint64_t length{0};
+		uint64_t matchEnd{0};
+		bool matched{false};
+		bool finished{false};
+	public:
+		MatchStream(): dfa(RegularExpression<Definition...>::template getDFA<compare>()), state{dfa.initial} { }
+		void reset()
 		{
-			
+			state = dfa.initial;
+			length = 0;
+			matchEnd = 0;
+			matched = false;
+			finished = false;
 		}
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		// automaton of regexp has at most DFA::maxStates states, otherwise stream doesn't accept any input (it would have to be kept whole for backtracking)
+		bool valid() const
 		{
-			size_t pos{0};
-			ssize_t lastFound{-1};
-			Closure closure;
-			
-			Repeat<min, max, Inner> innerContext{*this};
-			AllRightContext<Reference<NearestRight>, Right...> allRightContext{nright, right...};
-			
-			size_t tmp;
-			
-			for (unsigned int cycle{0}; (!max) || (cycle <= max); ++cycle)
+			return dfa.valid;
+		}
+		// returns true when match was found (rest of input doesn't need to be fed)
+		bool feed(const char * data, size_t size)
+		{
+			if (!dfa.valid) return false;
+			if (!matched && !finished)
 			{
-				if ((cycle >= min))
-				{
-					if (nright.getRef().match(string.add(pos), tmp = 0, deep+1, root, right...))
-					{
-						allRightContext.remember(nright, right...); 
-						//nright.getRef().reset(right...);
-						lastFound = pos + tmp;
-						DEBUG_PRINTF(">> found at %zu\n",lastFound);
-					}
-					else
-					{
-						//printf("\033[1;31mfail: "); AllRightContext<Reference<NearestRight>, Right...>::visualize(nright, right...); printf("\033[0m\n");
-					}
-				}
-				// in next expression "empty" is needed
-				*this = innerContext;
-				if (Inner::match(string.add(pos), tmp = 0, deep+1, root, makeRef(closure)))
-				{
-					innerContext = *this;
-					pos += tmp;
-				}
-				else 
+				size_t pos{0};
+				if (dfa.template resume<FirstCharacter<Sequence<Definition...>>>(BoundedCharacterAbstraction<char, compare>(data, data + size), state, pos))
 				{
-					if (lastFound >= 0)
-					{
-						//printf("CYCLE DONE\n");
-						*this = innerContext;
-						allRightContext.restore(nright, right...);
-						DEBUG_PRINTF("cycle done (cycle = %zu)\n",cycle);
-						move += static_cast<size_t>(lastFound);
-						return true;
-					}
-					else break;
+					matched = true;
+					matchEnd = length + pos;
 				}
-				
 			}
-			return false;
-		}
-		inline void reset()
-		{
-			Inner::reset();
-		}
-		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
-		{
-			return Inner::template getCatch<id>(catches);
+			length += size;
+			return matched;
 		}
-		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		bool feed(const std::string & data)
 		{
-			return Inner::template getIdentifier<rkey>();
+			return feed(data.data(), data.size());
 		}
-		template <bool envelope = true> std::ostream & toString(std::ostream & str) const
+		// end of input (End can match only here)
+		bool finish()
 		{
-			if (envelope)
+			if (matched || finished) return matched;
+			finished = true;
+			if (dfa.valid && dfa.acceptAtEnd[state])
 			{
-				if (min == 1 && max == 0) str << "Plus<";
-				else if (min == 0 && max == 0) str << "Star<";
-				else str << "Repeat<" << min << ',' << max << ',';
+				matched = true;
+				matchEnd = length;
 			}
-			if (false) Inner::template toString<false>(str);
-			else Inner::template toString<true>(str);
-			if (envelope) str << ">";
-			return str;
+			return matched;
 		}
-	};
-	
-	// wrapper for floating matching in string (begin regexp anywhere in string)
-	// without Eat<...> is regexp ABC equivalent to ^ABC$
-	template <typename... Inner> struct Eat: public Sequence<Inner...>
-	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		bool found() const
 		{
-			size_t pos{0};
-			
-			if (!string.exists() && Sequence<Inner...>::match(string, move, deep+1, root, nright, right...))
-			{
-				// branch just for empty strings
-				return true;
-			}
-			else while (string.exists(pos)) {
-				size_t imove{0};
-				//DEBUG_PRINTF("eating... (pos = %zu)\n",pos);
-				if (Sequence<Inner...>::match(string.add(pos), imove, deep+1, root, nright, right...))
-				{
-					move += pos + imove;
-					return true;
-				}
-				else
-				{
-					pos++;
-				}
-			}
-			return false;
+			return matched;
 		}
-		inline void reset()
+		// position in stream where found match ends
+		uint64_t offset() const
 		{
-			Sequence<Inner...>::reset();
+			return matchEnd;
 		}
-		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		// count of characters fed into stream
+		uint64_t size() const
 		{
-			return Sequence<Inner...>::template getCatch<id>(catches);
+			return length;
 		}
-		template <unsigned int rkey> inline unsigned int getIdentifier() const
+	};
+	
+	// every pattern is matched with own (temporary) state when patterns can't be matched together
+	template <unsigned int index, typename... Patterns> struct EachPattern
+	{
+		template <typename StringAbstraction> static inline DFA::Mask match(const StringAbstraction)
 		{
-			return Sequence<Inner...>::template getIdentifier<rkey>();
+			return 0;
 		}
 	};
 	
-	// debug template
-	template <unsigned int part, typename... Inner> struct Debug: Sequence<Inner...>
+	template <unsigned int index, typename First, typename... Rest> struct EachPattern<index, First, Rest...>
 	{
-		template <typename StringAbstraction, typename Root, typename NearestRight, typename... Right> inline bool match(const StringAbstraction string, size_t & move, unsigned int deep, Root & root, Reference<NearestRight> nright, Right... right)
+		template <typename StringAbstraction> static inline DFA::Mask match(const StringAbstraction string)
 		{
-			if (Sequence<Inner...>::match(string, move, deep, root, nright, right...))
-			{
-				std::cout << "[part "<<part<<": match; pos="<<string.getPosition()<<"; move="<<move<<"; right="<<sizeof...(Right)<<"]\n";
-				return true;
-			}
-			else
-			{
-				std::cout << "[part "<<part<<": no match; pos="<<string.getPosition()<<"; move="<<move<<"; right="<<sizeof...(Right)<<"]\n";
-				return false;
-			}
+			Eat<typename SizedCatches<First, 1>::Type> state;
+			size_t pos{0};
+			Closure closure;
+			const DFA::Mask found{state.match(string, pos, 0, state, makeRef(closure)) ? DFA::Mask{1} << index : DFA::Mask{0}};
+			return found | EachPattern<index + 1, Rest...>::match(string);
 		}
-		inline void reset()
+	};
+	
+	// more regexps matched in one pass over input, result has bit (1 << i) set when i-th pattern matches
+	// pattern is one part of regexp (use Seq<...> for more parts), catches aren't reported
+	template <typename... Patterns> struct PatternSet
+	{
+		static_assert(sizeof...(Patterns) <= 64, "PatternSet supports at most 64 patterns");
+		using Mask = DFA::Mask;
+		static const constexpr Mask all{sizeof...(Patterns) == 64 ? ~Mask{0} : (Mask{1} << sizeof...(Patterns)) - 1};
+		// patterns without catches and identifiers are matched together with one DFA
+		static const constexpr bool deterministic{NFABuilder<Selection<Patterns...>>::supported};
+	protected:
+		using Deterministic = std::integral_constant<bool, deterministic>;
+		template <CompareFnc<char> compare> static NFA buildNFA()
 		{
-			Sequence<Inner...>::reset();
+			NFA nfa;
+			nfa.start = NFAPatternsBuilder<Patterns...>::template build<compare>(nfa, 0);
+			return nfa;
 		}
-		template <unsigned int id> inline bool getCatch(CatchReturn & catches) const
+		template <CompareFnc<char> compare> static const DFA & getDFA()
 		{
-			return Sequence<Inner...>::template getCatch<id>(catches);
+			static const DFA dfa{buildNFA<compare>()};
+			return dfa;
 		}
-		template <unsigned int rkey> inline unsigned int getIdentifier() const
+		template <CompareFnc<char> compare, typename StringAbstraction> static inline Mask search(const StringAbstraction string, std::true_type)
 		{
-			return Sequence<Inner...>::template getIdentifier<rkey>();
+			const DFA & dfa = getDFA<compare>();
+			if (dfa.valid) return dfa.template searchAll<FirstCharacter<Selection<Patterns...>>>(string, all);
+			else return EachPattern<0, Patterns...>::match(string);
 		}
-	};
-	
-	// templated struct which contains regular expression and is used be user :)
-	template <typename... Definition> struct RegularExpression
-	{
-		Eat<Definition...> eat;
-		void reset()
+		template <CompareFnc<char>, typename StringAbstraction> static inline Mask search(const StringAbstraction string, std::false_type)
 		{
-			eat.reset();
+			return EachPattern<0, Patterns...>::match(string);
 		}
-		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(std::string string)
+	public:
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline Mask operator()(const char * string) const
 		{
-			size_t pos{0};
-			Closure closure;
-			return eat.match(StringAbstraction<const char *, const char, compare>(string.c_str()), pos, 0, eat, makeRef(closure));
+			return search<compare>(StringAbstraction<const char *, const char, compare>(string), Deterministic{});
 		}
-		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const char * string)
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline Mask operator()(const char * begin, const char * end) const
 		{
-			size_t pos{0};
-			Closure closure;
-			return eat.match(StringAbstraction<const char *, const char, compare>(string), pos, 0, eat, makeRef(closure));
+			return search<compare>(BoundedCharacterAbstraction<char, compare>(begin, end), Deterministic{});
 		}
-		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool operator()(std::wstring string)
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline Mask operator()(const char * string, size_t length) const
 		{
-			size_t pos{0};
-			Closure closure;
-			return eat.match(StringAbstraction<const wchar_t *, const wchar_t, compare>(string.c_str()), pos, 0, eat, makeRef(closure));
+			return operator()<compare>(string, string + length);
 		}
-		template <CompareFnc<wchar_t> compare =  charactersAreEqual<wchar_t>> inline bool operator()(const wchar_t * string)
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline Mask operator()(const std::string & string) const
 		{
-			size_t pos{0};
-			Closure closure;
-			return eat.match(StringAbstraction<const wchar_t *, const wchar_t, compare>(string), pos, 0, eat, makeRef(closure));
+			return operator()<compare>(string.data(), string.data() + string.size());
 		}
-		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(std::string string)
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline Mask operator()(const wchar_t * string) const
 		{
-			return operator()<compare>(string);
+			return EachPattern<0, Patterns...>::match(StringAbstraction<const wchar_t *, const wchar_t, compare>(string));
 		}
-		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string)
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline Mask operator()(const wchar_t * begin, const wchar_t * end) const
 		{
-			return operator()<compare>(string);
+			return EachPattern<0, Patterns...>::match(BoundedCharacterAbstraction<wchar_t, compare>(begin, end));
 		}
-		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(std::wstring string)
+		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline Mask operator()(const std::wstring & string) const
 		{
-			return operator()<compare>(string);
+			return operator()<compare>(string.data(), string.data() + string.size());
 		}
-		template <CompareFnc<wchar_t> compare = charactersAreEqual<wchar_t>> inline bool match(const wchar_t * string)
+		#if __cplusplus >= 201703L
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline Mask operator()(std::string_view string) const
 		{
-			return operator()<compare>(string);
+			return operator()<compare>(string.data(), string.data() + string.size());
 		}
-		template <unsigned int key> unsigned int getIdentifier()
+		#endif
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline Mask match(const char * string) const
 		{
-			return eat.template getIdentifier<key>();
+			return operator()<compare>(string);
 		}
-		template <unsigned int id> inline CatchReturn getCatch()
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline Mask match(const char * begin, const char * end) const
 		{
-			CatchReturn catches;
-			eat.template getCatch<id>(catches);
-			return catches;
+			return operator()<compare>(begin, end);
 		}
-		template <unsigned int id, typename StringType> inline auto part(const StringType string, unsigned int subid = 0) -> decltype(string)
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline Mask match(const std::string & string) const
 		{
-			return string.substr(getCatch<id>()[subid].begin, getCatch<id>()[subid].length);
+			return operator()<compare>(string);
 		}
 	};
 }
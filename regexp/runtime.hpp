@@ -0,0 +1,918 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014-2015 Hana Dusíková (hanicka@hanicka.net)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef __REGEXP__RUNTIME__HPP__
+#define __REGEXP__RUNTIME__HPP__
+
+#include "regexp.hpp"
+
+namespace SRX {
+
+	// regexp compiled from pattern at runtime (same PCRE subset as SRX_REGEXP in pattern.hpp), only for one-byte characters
+	// it's matched with DFA if it has no back-references, atomic groups and possessive cycles, catches are found with backtracking over bytecode
+	struct RuntimeRegularExpression;
+
+	// parsed pattern
+	struct RuntimeNode
+	{
+		enum class Type: uint8_t { Empty, Characters, Begin, End, Sequence, Selection, Repeat, Catch, BackReference, Atomic };
+		Type type{Type::Empty};
+		std::vector<RuntimeNode> inner;
+		// characters are pairs of bounds
+		bool positive{true};
+		std::vector<std::pair<char, char>> bounds;
+		// cycle (max = 0 is unbounded)
+		unsigned int min{0};
+		unsigned int max{0};
+		// catch or back-reference
+		unsigned int id{0};
+		RuntimeNode() = default;
+		explicit RuntimeNode(Type ltype): type{ltype} { }
+		bool nullable() const
+		{
+			switch (type)
+			{
+				case Type::Characters: return false;
+				case Type::BackReference: return true;
+				case Type::Repeat: return min == 0 || inner.front().nullable();
+				case Type::Selection:
+					for (const RuntimeNode & node: inner) if (node.nullable()) return true;
+					return false;
+				default:
+					for (const RuntimeNode & node: inner) if (!node.nullable()) return false;
+					return true;
+			}
+		}
+		bool deterministic() const
+		{
+			if (type == Type::BackReference || type == Type::Atomic) return false;
+			for (const RuntimeNode & node: inner) if (!node.deterministic()) return false;
+			return true;
+		}
+	};
+
+	// recursive descent parser, errors are reported with message and position
+	struct RuntimeParser
+	{
+		static const constexpr unsigned int maxCount{1000};
+		const std::string & pattern;
+		size_t pos{0};
+		unsigned int nextId{1};
+		const char * error{nullptr};
+		explicit RuntimeParser(const std::string & lpattern): pattern(lpattern) { }
+		bool parse(RuntimeNode & root)
+		{
+			if (!alternation(root)) return false;
+			if (pos != pattern.size()) return fail("unbalanced ')' in pattern");
+			return true;
+		}
+	protected:
+		bool fail(const char * message)
+		{
+			error = message;
+			return false;
+		}
+		bool end() const
+		{
+			return pos >= pattern.size();
+		}
+		char peek(size_t offset = 0) const
+		{
+			return pos + offset < pattern.size() ? pattern[pos + offset] : '\0';
+		}
+		static RuntimeNode characters(bool positive, std::initializer_list<std::pair<char, char>> bounds)
+		{
+			RuntimeNode node{RuntimeNode::Type::Characters};
+			node.positive = positive;
+			node.bounds = bounds;
+			return node;
+		}
+		// other escaped letters and \0 (\b, \A, \x41, ...) mean something else in PCRE, so they aren't matched as literals
+		static bool supportedEscape(char e)
+		{
+			return e == 'n' || e == 't' || e == 'r' || e == 'f' || e == 'v' || !((e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z') || e == '0');
+		}
+		static char escaped(char e)
+		{
+			return e == 'n' ? '\n' : e == 't' ? '\t' : e == 'r' ? '\r' : e == 'f' ? '\f' : e == 'v' ? '\v' : e;
+		}
+		// \d \w \s and their negations
+		static bool escapedClass(char e, RuntimeNode & node)
+		{
+			switch (e)
+			{
+				case 'd': case 'D': node = characters(e == 'd', {{'0','9'}}); return true;
+				case 'w': case 'W': node = characters(e == 'w', {{'a','z'},{'A','Z'},{'0','9'},{'_','_'}}); return true;
+				case 's': case 'S': node = characters(e == 's', {{' ',' '},{'\t','\t'},{'\n','\n'},{'\r','\r'},{'\f','\f'},{'\v','\v'}}); return true;
+				default: return false;
+			}
+		}
+		bool alternation(RuntimeNode & node)
+		{
+			RuntimeNode option;
+			if (!sequence(option)) return false;
+			if (peek() != '|' || end())
+			{
+				node = std::move(option);
+				return true;
+			}
+			node = RuntimeNode{RuntimeNode::Type::Selection};
+			node.inner.push_back(std::move(option));
+			while (peek() == '|' && !end())
+			{
+				++pos;
+				if (!sequence(option)) return false;
+				node.inner.push_back(std::move(option));
+			}
+			return true;
+		}
+		bool sequence(RuntimeNode & node)
+		{
+			node = RuntimeNode{RuntimeNode::Type::Sequence};
+			while (!end() && peek() != '|' && peek() != ')')
+			{
+				RuntimeNode item;
+				if (!atom(item) || !quantifier(item)) return false;
+				node.inner.push_back(std::move(item));
+			}
+			return true;
+		}
+		bool atom(RuntimeNode & node)
+		{
+			const char c{peek()};
+			++pos;
+			switch (c)
+			{
+				case '*': case '+': case '?': case '{': --pos; return fail("nothing to repeat in pattern");
+				case '.': node = characters(false, {}); return true;
+				case '^': node = RuntimeNode{RuntimeNode::Type::Begin}; return true;
+				case '$': node = RuntimeNode{RuntimeNode::Type::End}; return true;
+				case '[': return characterClass(node);
+				case '(': return group(node);
+				case '\\':
+					if (end()) return fail("missing escaped character in pattern");
+					if (escapedClass(peek(), node))
+					{
+						++pos;
+						return true;
+					}
+					if (peek() >= '1' && peek() <= '9')
+					{
+						node = RuntimeNode{RuntimeNode::Type::BackReference};
+						node.id = static_cast<unsigned int>(peek() - '0');
+						++pos;
+						return true;
+					}
+					if (!supportedEscape(peek())) return fail("unsupported escape in pattern");
+					node = characters(true, {{escaped(peek()), escaped(peek())}});
+					++pos;
+					return true;
+				default:
+					node = characters(true, {{c, c}});
+					return true;
+			}
+		}
+		bool group(RuntimeNode & node)
+		{
+			RuntimeNode inner;
+			if (peek() == '?' && (peek(1) == ':' || peek(1) == '>'))
+			{
+				const bool atomic{peek(1) == '>'};
+				pos += 2;
+				if (!alternation(inner)) return false;
+				if (atomic)
+				{
+					node = RuntimeNode{RuntimeNode::Type::Atomic};
+					node.inner.push_back(std::move(inner));
+				}
+				else node = std::move(inner);
+			}
+			else
+			{
+				node = RuntimeNode{RuntimeNode::Type::Catch};
+				node.id = nextId++;
+				if (!alternation(inner)) return false;
+				node.inner.push_back(std::move(inner));
+			}
+			if (peek() != ')' || end()) return fail("missing ')' in pattern");
+			++pos;
+			return true;
+		}
+		bool characterClass(RuntimeNode & node)
+		{
+			node = characters(true, {});
+			if (peek() == '^' && !end())
+			{
+				node.positive = false;
+				++pos;
+			}
+			// ']' right after '[' or '[^' is literal ([]a] contains ] and a)
+			for (bool initial{true}; !end() && (peek() != ']' || initial); initial = false)
+			{
+				char first{peek()};
+				++pos;
+				if (first == '\\')
+				{
+					if (end()) break;
+					RuntimeNode escapes;
+					if (escapedClass(peek(), escapes))
+					{
+						if (!escapes.positive) return fail("negative class can't be part of [...] in pattern");
+						node.bounds.insert(node.bounds.end(), escapes.bounds.begin(), escapes.bounds.end());
+						++pos;
+						continue;
+					}
+					if (peek() >= '1' && peek() <= '9') return fail("back-reference can't be part of [...] in pattern");
+					if (!supportedEscape(peek())) return fail("unsupported escape in pattern");
+					first = escaped(peek());
+					++pos;
+				}
+				// [a-] contains a and -
+				if (peek() == '-' && peek(1) != ']' && pos + 1 < pattern.size())
+				{
+					node.bounds.emplace_back(first, peek(1));
+					pos += 2;
+				}
+				else node.bounds.emplace_back(first, first);
+			}
+			if (end()) return fail("missing ']' in pattern");
+			++pos;
+			return true;
+		}
+		bool number(unsigned int & value)
+		{
+			if (peek() < '0' || peek() > '9' || end()) return false;
+			value = 0;
+			while (peek() >= '0' && peek() <= '9' && !end())
+			{
+				value = value * 10 + static_cast<unsigned int>(peek() - '0');
+				if (value > maxCount) return false;
+				++pos;
+			}
+			return true;
+		}
+		bool quantifier(RuntimeNode & node)
+		{
+			unsigned int min{0}, max{0};
+			bool infinite{false};
+			switch (peek())
+			{
+				case '*': infinite = true; break;
+				case '+': min = 1; infinite = true; break;
+				case '?': max = 1; break;
+				case '{':
+					++pos;
+					if (!number(min)) return fail("wrong bounds {n,m} in pattern");
+					if (peek() == ',' && peek(1) == '}') infinite = true, ++pos;
+					else if (peek() == ',')
+					{
+						++pos;
+						if (!number(max) || max < min) return fail("wrong bounds {n,m} in pattern");
+					}
+					else max = min;
+					if (peek() != '}') return fail("wrong bounds {n,m} in pattern");
+					break;
+				default:
+					return true;
+			}
+			++pos;
+			if (!infinite && max == 0)
+			{
+				node = RuntimeNode{RuntimeNode::Type::Empty};
+				return true;
+			}
+			RuntimeNode repeat{RuntimeNode::Type::Repeat};
+			repeat.min = min;
+			repeat.max = infinite ? 0 : max;
+			repeat.inner.push_back(std::move(node));
+			if (peek() == '?' && !end()) return fail("lazy quantifiers aren't supported");
+			if (peek() == '+' && !end())
+			{
+				++pos;
+				node = RuntimeNode{RuntimeNode::Type::Atomic};
+				node.inner.push_back(std::move(repeat));
+			}
+			else node = std::move(repeat);
+			return true;
+		}
+	};
+
+	// bytecode for backtracking
+	struct RuntimeInstruction
+	{
+		enum class Type: uint8_t { Character, Split, Jump, CatchBegin, CatchEnd, Begin, End, BackReference, AtomicBegin, AtomicEnd, Mark, Progress, Match };
+		Type type;
+		// Character: class, Split: preferred and other target, Jump: target, catches: id, Mark/Progress: register
+		unsigned int a;
+		unsigned int b;
+	};
+
+	struct RuntimeClass
+	{
+		bool positive;
+		std::vector<std::pair<char, char>> bounds;
+		std::bitset<256> table;
+		template <CompareFnc<char> compare> bool check(const char c) const
+		{
+			for (const std::pair<char, char> & bound: bounds) if (compare(c, bound.first, bound.second)) return positive;
+			return !positive;
+		}
+	};
+
+	struct RuntimeProgram
+	{
+		static const constexpr size_t maxSize{1u << 20};
+		std::vector<RuntimeInstruction> code;
+		std::vector<RuntimeClass> classes;
+		unsigned int catchCount{0};
+		unsigned int registerCount{0};
+		// characters which can begin match, anchored program can match only at first position
+		std::bitset<256> first;
+		bool skippable{false};
+		bool anchored{false};
+
+		bool compile(const RuntimeNode & root, unsigned int catches)
+		{
+			catchCount = catches;
+			registerCount = catches + 1;
+			if (!emit(root)) return false;
+			add(RuntimeInstruction::Type::Match);
+			analyze();
+			return true;
+		}
+	protected:
+		unsigned int add(RuntimeInstruction::Type type, unsigned int a = 0, unsigned int b = 0)
+		{
+			code.push_back(RuntimeInstruction{type, a, b});
+			return static_cast<unsigned int>(code.size() - 1);
+		}
+		unsigned int here() const
+		{
+			return static_cast<unsigned int>(code.size());
+		}
+		bool emit(const RuntimeNode & node)
+		{
+			if (code.size() > maxSize) return false;
+			using Type = RuntimeNode::Type;
+			switch (node.type)
+			{
+				case Type::Empty: return true;
+				case Type::Characters:
+				{
+					RuntimeClass characters{node.positive, node.bounds, {}};
+					for (unsigned int c{0}; c != 256; ++c) characters.table[c] = characters.check<charactersAreEqual<char>>(static_cast<char>(c));
+					classes.push_back(std::move(characters));
+					add(RuntimeInstruction::Type::Character, static_cast<unsigned int>(classes.size() - 1));
+					return true;
+				}
+				case Type::Begin: add(RuntimeInstruction::Type::Begin); return true;
+				case Type::End: add(RuntimeInstruction::Type::End); return true;
+				case Type::BackReference: add(RuntimeInstruction::Type::BackReference, node.id); return true;
+				case Type::Sequence:
+					for (const RuntimeNode & inner: node.inner) if (!emit(inner)) return false;
+					return true;
+				case Type::Selection:
+				{
+					std::vector<unsigned int> jumps;
+					for (size_t i{0}; i != node.inner.size(); ++i)
+					{
+						const unsigned int split{i + 1 != node.inner.size() ? add(RuntimeInstruction::Type::Split, here() + 1) : 0};
+						if (!emit(node.inner[i])) return false;
+						if (i + 1 != node.inner.size())
+						{
+							jumps.push_back(add(RuntimeInstruction::Type::Jump));
+							code[split].b = here();
+						}
+					}
+					for (unsigned int jump: jumps) code[jump].a = here();
+					return true;
+				}
+				case Type::Catch:
+					add(RuntimeInstruction::Type::CatchBegin, node.id);
+					if (!emit(node.inner.front())) return false;
+					add(RuntimeInstruction::Type::CatchEnd, node.id);
+					return true;
+				case Type::Atomic:
+					add(RuntimeInstruction::Type::AtomicBegin);
+					if (!emit(node.inner.front())) return false;
+					add(RuntimeInstruction::Type::AtomicEnd);
+					return true;
+				case Type::Repeat:
+				{
+					const RuntimeNode & inner = node.inner.front();
+					for (unsigned int i{0}; i != node.min; ++i) if (!emit(inner)) return false;
+					if (node.max == 0)
+					{
+						// cycle which doesn't move can't be repeated
+						const bool nullable{inner.nullable()};
+						const unsigned int mark{nullable ? registerCount++ : 0};
+						const unsigned int split{add(RuntimeInstruction::Type::Split, here() + 1)};
+						if (nullable) add(RuntimeInstruction::Type::Mark, mark);
+						if (!emit(inner)) return false;
+						if (nullable) add(RuntimeInstruction::Type::Progress, mark);
+						add(RuntimeInstruction::Type::Jump, split);
+						code[split].b = here();
+						return true;
+					}
+					std::vector<unsigned int> splits;
+					for (unsigned int i{node.min}; i != node.max; ++i)
+					{
+						splits.push_back(add(RuntimeInstruction::Type::Split, here() + 1));
+						if (!emit(inner)) return false;
+					}
+					for (unsigned int split: splits) code[split].b = here();
+					return true;
+				}
+			}
+			return false;
+		}
+		// characters reachable from beginning without consuming anything (Begin is passable or stops the walk)
+		void walk(bool passBegin, std::bitset<256> & characters, bool & anywhere, bool & begin) const
+		{
+			std::vector<bool> visited(code.size(), false);
+			std::vector<unsigned int> stack{0};
+			while (!stack.empty())
+			{
+				const unsigned int pc{stack.back()};
+				stack.pop_back();
+				if (visited[pc]) continue;
+				visited[pc] = true;
+				const RuntimeInstruction & instruction = code[pc];
+				switch (instruction.type)
+				{
+					case RuntimeInstruction::Type::Character: characters |= classes[instruction.a].table; break;
+					case RuntimeInstruction::Type::Split: stack.push_back(instruction.b); stack.push_back(instruction.a); break;
+					case RuntimeInstruction::Type::Jump: stack.push_back(instruction.a); break;
+					case RuntimeInstruction::Type::Begin:
+						begin = true;
+						if (passBegin) stack.push_back(pc + 1);
+						break;
+					case RuntimeInstruction::Type::End:
+					case RuntimeInstruction::Type::BackReference:
+					case RuntimeInstruction::Type::Match: anywhere = true; break;
+					default: stack.push_back(pc + 1);
+				}
+			}
+		}
+		void analyze()
+		{
+			std::bitset<256> characters;
+			bool anywhere{false}, begin{false};
+			walk(false, characters, anywhere, begin);
+			anchored = !anywhere && begin && characters.none();
+			walk(true, first, anywhere, begin);
+			skippable = !anywhere;
+		}
+	};
+
+	// catch found by backtracking
+	struct RuntimeCatch
+	{
+		unsigned int id;
+		Catch content;
+	};
+
+	// scratch memory of backtracking (reused between matches)
+	struct RuntimeState
+	{
+		struct Frame
+		{
+			unsigned int pc;
+			size_t pos;
+			size_t catches;
+			size_t undo;
+		};
+		static const constexpr unsigned int barrier{~0u};
+		std::vector<Frame> stack;
+		std::vector<size_t> registers;
+		std::vector<std::pair<unsigned int, size_t>> undo;
+		std::vector<RuntimeCatch> catches;
+		void set(unsigned int index, size_t value)
+		{
+			undo.emplace_back(index, registers[index]);
+			registers[index] = value;
+		}
+		void restore(const Frame & frame)
+		{
+			while (undo.size() > frame.undo)
+			{
+				registers[undo.back().first] = undo.back().second;
+				undo.pop_back();
+			}
+			catches.resize(frame.catches);
+		}
+	};
+
+	// result of const matching (catches and span), every thread can have own results and share regexp
+	template <> struct MatchResults<RuntimeRegularExpression>
+	{
+		RuntimeState state;
+		// catches ordered by id (offsets[id] is index of first one)
+		std::vector<Catch> catches;
+		std::vector<size_t> offsets;
+		size_t matchBegin{0};
+		size_t matchEnd{0};
+		// span is known only after successful backtracking (not after DFA)
+		bool spanFound{false};
+		void reset()
+		{
+			catches.clear();
+			offsets.clear();
+			matchBegin = matchEnd = 0;
+			spanFound = false;
+		}
+		void collect(unsigned int count)
+		{
+			offsets.assign(count + 2, 0);
+			for (const RuntimeCatch & found: state.catches) ++offsets[found.id + 1];
+			for (unsigned int id{1}; id < offsets.size(); ++id) offsets[id] += offsets[id - 1];
+			catches.resize(state.catches.size());
+			for (const RuntimeCatch & found: state.catches) catches[offsets[found.id]++] = found.content;
+			// offsets were moved to end of every id
+			for (unsigned int id{static_cast<unsigned int>(offsets.size() - 1)}; id > 0; --id) offsets[id] = offsets[id - 1];
+			offsets[0] = 0;
+		}
+		CatchReturn getCatch(unsigned int id) const
+		{
+			if (id + 1 >= offsets.size()) return CatchReturn{};
+			return CatchReturn{catches.data() + offsets[id], offsets[id + 1] - offsets[id]};
+		}
+		template <unsigned int id> inline CatchReturn getCatch() const
+		{
+			return getCatch(id);
+		}
+		template <typename StringType> inline auto part(unsigned int id, const StringType string, unsigned int subid = 0) const -> decltype(string)
+		{
+			return string.substr(getCatch(id)[subid].begin, getCatch(id)[subid].length);
+		}
+		template <unsigned int id, typename StringType> inline auto part(const StringType string, unsigned int subid = 0) const -> decltype(string)
+		{
+			return part(id, string, subid);
+		}
+		// span of whole match
+		size_t position() const
+		{
+			return matchBegin;
+		}
+		size_t length() const
+		{
+			return matchEnd - matchBegin;
+		}
+		template <typename StringType> inline auto whole(const StringType string) const -> decltype(string)
+		{
+			return string.substr(position(), length());
+		}
+	};
+
+	struct RuntimeRegularExpression
+	{
+		using Results = MatchResults<RuntimeRegularExpression>;
+	protected:
+		RuntimeProgram program;
+		DFA dfa;
+		const char * message{nullptr};
+		size_t errorPos{0};
+		// state of non-const matching
+		Results results;
+
+		NFA buildNFA(const RuntimeNode & root) const
+		{
+			NFA nfa;
+			nfa.start = build(nfa, root, nfa.addMatch());
+			return nfa;
+		}
+		// same lowering as NFABuilder in regexp.hpp
+		static unsigned int build(NFA & nfa, const RuntimeNode & node, unsigned int next)
+		{
+			using Type = RuntimeNode::Type;
+			switch (node.type)
+			{
+				case Type::Characters:
+				{
+					bool table[256];
+					RuntimeClass characters{node.positive, node.bounds, {}};
+					for (unsigned int c{0}; c != 256; ++c) table[c] = characters.check<charactersAreEqual<char>>(static_cast<char>(c));
+					return nfa.addCharacter(table, next);
+				}
+				case Type::Begin: return nfa.add(NFAState::Type::Begin, next);
+				case Type::End: return nfa.add(NFAState::Type::End, next);
+				case Type::Sequence:
+					for (size_t i{node.inner.size()}; i > 0; --i) next = build(nfa, node.inner[i - 1], next);
+					return next;
+				case Type::Selection:
+				{
+					unsigned int entry{build(nfa, node.inner.back(), next)};
+					for (size_t i{node.inner.size() - 1}; i > 0; --i) entry = nfa.addSplit(build(nfa, node.inner[i - 1], next), entry);
+					return entry;
+				}
+				case Type::Catch: return build(nfa, node.inner.front(), next);
+				case Type::Repeat:
+				{
+					unsigned int entry{next};
+					if (node.max == 0)
+					{
+						entry = nfa.addSplit(0, next);
+						const unsigned int inner{build(nfa, node.inner.front(), entry)};
+						nfa.states[entry].out1 = inner;
+					}
+					else for (unsigned int i{node.min}; i < node.max; ++i)
+					{
+						entry = nfa.addSplit(build(nfa, node.inner.front(), entry), next);
+					}
+					for (unsigned int i{0}; i < node.min; ++i) entry = build(nfa, node.inner.front(), entry);
+					return entry;
+				}
+				default: return next;
+			}
+		}
+		template <CompareFnc<char> compare> inline bool character(unsigned int index, const char c) const
+		{
+			const RuntimeClass & characters = program.classes[index];
+			if (compare == charactersAreEqual<char>) return characters.table[static_cast<unsigned char>(c)];
+			return characters.template check<compare>(c);
+		}
+		// backtracking from one position, end of match is returned in end
+		template <CompareFnc<char> compare> bool run(const char * begin, const char * last, size_t pos, RuntimeState & state, size_t & end) const
+		{
+			using Type = RuntimeInstruction::Type;
+			const size_t length{static_cast<size_t>(last - begin)};
+			state.stack.clear();
+			state.undo.clear();
+			state.catches.clear();
+			state.registers.assign(program.registerCount, ~size_t{0});
+			unsigned int pc{0};
+			for (;;)
+			{
+				const RuntimeInstruction & instruction = program.code[pc];
+				bool ok{true};
+				switch (instruction.type)
+				{
+					case Type::Character:
+						ok = pos < length && character<compare>(instruction.a, begin[pos]);
+						++pos;
+						++pc;
+						break;
+					case Type::Split:
+						state.stack.push_back(RuntimeState::Frame{instruction.b, pos, state.catches.size(), state.undo.size()});
+						pc = instruction.a;
+						break;
+					case Type::Jump:
+						pc = instruction.a;
+						break;
+					case Type::CatchBegin:
+						state.set(instruction.a, pos);
+						++pc;
+						break;
+					case Type::CatchEnd:
+						state.catches.push_back(RuntimeCatch{instruction.a, Catch{static_cast<uint32_t>(state.registers[instruction.a]), static_cast<uint32_t>(pos - state.registers[instruction.a])}});
+						++pc;
+						break;
+					case Type::Begin:
+						ok = pos == 0;
+						++pc;
+						break;
+					case Type::End:
+						ok = pos == length;
+						++pc;
+						break;
+					case Type::BackReference:
+					{
+						// last content of catch
+						ok = false;
+						for (size_t i{state.catches.size()}; i > 0; --i)
+						{
+							const RuntimeCatch & found = state.catches[i - 1];
+							if (found.id != instruction.a) continue;
+							if (found.content.length > length - pos) break;
+							ok = true;
+							for (size_t j{0}; ok && j != found.content.length; ++j) ok = compare(begin[pos + j], begin[found.content.begin + j], begin[found.content.begin + j]);
+							if (ok) pos += found.content.length;
+							break;
+						}
+						++pc;
+						break;
+					}
+					case Type::AtomicBegin:
+						state.stack.push_back(RuntimeState::Frame{RuntimeState::barrier, pos, state.catches.size(), state.undo.size()});
+						++pc;
+						break;
+					case Type::AtomicEnd:
+						// alternatives inside of group are forgotten
+						while (state.stack.back().pc != RuntimeState::barrier) state.stack.pop_back();
+						state.stack.pop_back();
+						++pc;
+						break;
+					case Type::Mark:
+						state.set(instruction.a, pos);
+						++pc;
+						break;
+					case Type::Progress:
+						ok = state.registers[instruction.a] != pos;
+						++pc;
+						break;
+					case Type::Match:
+						end = pos;
+						return true;
+				}
+				if (ok) continue;
+				for (;;)
+				{
+					if (state.stack.empty()) return false;
+					const RuntimeState::Frame frame = state.stack.back();
+					state.stack.pop_back();
+					if (frame.pc == RuntimeState::barrier) continue;
+					state.restore(frame);
+					pc = frame.pc;
+					pos = frame.pos;
+					break;
+				}
+			}
+		}
+		// match can begin at every character (or at beginning of empty input)
+		template <CompareFnc<char> compare> bool backtrack(const char * begin, const char * end, Results & state) const
+		{
+			const size_t length{static_cast<size_t>(end - begin)};
+			const bool skip{program.skippable && compare == charactersAreEqual<char>};
+			for (size_t pos{0}; pos < length || pos == 0; ++pos)
+			{
+				if (program.anchored && pos) break;
+				if (skip && pos < length && !program.first[static_cast<unsigned char>(begin[pos])]) continue;
+				size_t last{0};
+				if (run<compare>(begin, end, pos, state.state, last))
+				{
+					state.matchBegin = pos;
+					state.matchEnd = last;
+					state.spanFound = true;
+					state.collect(program.catchCount);
+					return true;
+				}
+			}
+			return false;
+		}
+		// DFA (only for default compare function) doesn't know span and catches, they are found with backtracking
+		template <CompareFnc<char> compare> bool search(const char * begin, const char * end, Results & state, bool span) const
+		{
+			state.reset();
+			if (message) return false;
+			if (compare == charactersAreEqual<char> && dfa.valid)
+			{
+				if (!dfa.template search<FirstCharacter<Closure>>(BoundedCharacterAbstraction<char>(begin, end))) return false;
+				if (!span) return true;
+			}
+			return backtrack<compare>(begin, end, state);
+		}
+	public:
+		explicit RuntimeRegularExpression(const std::string & pattern)
+		{
+			RuntimeNode root;
+			RuntimeParser parser{pattern};
+			if (!parser.parse(root))
+			{
+				message = parser.error;
+				errorPos = parser.pos;
+				return;
+			}
+			if (!program.compile(root, parser.nextId))
+			{
+				message = "pattern is too big";
+				return;
+			}
+			if (root.deterministic()) dfa = DFA{buildNFA(root)};
+		}
+		// pattern was parsed (otherwise nothing matches)
+		bool valid() const
+		{
+			return !message;
+		}
+		const char * error() const
+		{
+			return message;
+		}
+		size_t errorPosition() const
+		{
+			return errorPos;
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const char * begin, const char * end)
+		{
+			return search<compare>(begin, end, results, false);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const char * string, size_t length)
+		{
+			return operator()<compare>(string, string + length);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const char * string)
+		{
+			return operator()<compare>(string, string + strlen(string));
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(const std::string & string)
+		{
+			return operator()<compare>(string.data(), string.data() + string.size());
+		}
+		#if __cplusplus >= 201703L
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool operator()(std::string_view string)
+		{
+			return operator()<compare>(string.data(), string.data() + string.size());
+		}
+		#endif
+		// same as operator() but catches and span are known also for regexp matched with DFA
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * begin, const char * end)
+		{
+			return search<compare>(begin, end, results, true);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string, size_t length)
+		{
+			return match<compare>(string, string + length);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string)
+		{
+			return match<compare>(string, string + strlen(string));
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const std::string & string)
+		{
+			return match<compare>(string.data(), string.data() + string.size());
+		}
+		#if __cplusplus >= 201703L
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(std::string_view string)
+		{
+			return match<compare>(string.data(), string.data() + string.size());
+		}
+		#endif
+		// const (thread-safe) matching, catches are stored in results
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * begin, const char * end, Results & external) const
+		{
+			return search<compare>(begin, end, external, true);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string, size_t length, Results & external) const
+		{
+			return match<compare>(string, string + length, external);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const char * string, Results & external) const
+		{
+			return match<compare>(string, string + strlen(string), external);
+		}
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(const std::string & string, Results & external) const
+		{
+			return match<compare>(string.data(), string.data() + string.size(), external);
+		}
+		#if __cplusplus >= 201703L
+		template <CompareFnc<char> compare = charactersAreEqual<char>> inline bool match(std::string_view string, Results & external) const
+		{
+			return match<compare>(string.data(), string.data() + string.size(), external);
+		}
+		#endif
+		CatchReturn getCatch(unsigned int id) const
+		{
+			return results.getCatch(id);
+		}
+		template <unsigned int id> inline CatchReturn getCatch() const
+		{
+			return results.getCatch(id);
+		}
+		template <typename StringType> inline auto part(unsigned int id, const StringType string, unsigned int subid = 0) const -> decltype(string)
+		{
+			return results.part(id, string, subid);
+		}
+		template <unsigned int id, typename StringType> inline auto part(const StringType string, unsigned int subid = 0) const -> decltype(string)
+		{
+			return results.part(id, string, subid);
+		}
+		// operator() of deterministic pattern finds match with DFA only, span (and catches) are known only after match()
+		bool hasSpan() const
+		{
+			return results.spanFound;
+		}
+		size_t position() const
+		{
+			return results.position();
+		}
+		size_t length() const
+		{
+			return results.length();
+		}
+		template <typename StringType> inline auto whole(const StringType string) const -> decltype(string)
+		{
+			return results.whole(string);
+		}
+	};
+
+}
+
+#endif
@@ -0,0 +1,471 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2014-2015 Hana Dusíková (hanicka@hanicka.net)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef __REGEXP__SCAN__HPP__
+#define __REGEXP__SCAN__HPP__
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SANITIZE_ADDRESS__)
+// aligned loads below can read before/after string (in same page), ASAN doesn't like it
+#define SRX_NO_SIMD
+#endif
+
+#if !defined(SRX_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define SRX_SIMD_AVX2
+#elif !defined(SRX_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define SRX_SIMD_SSE2
+#endif
+
+namespace SRX {
+
+	// compile-time list of indexes (std::index_sequence is not in c++11)
+	template <size_t... I> struct IndexList { };
+
+	template <typename A, typename B> struct ConcatIndexList;
+
+	template <size_t... A, size_t... B> struct ConcatIndexList<IndexList<A...>, IndexList<B...>>
+	{
+		using type = IndexList<A..., (sizeof...(A) + B)...>;
+	};
+
+	template <size_t N> struct MakeIndexList
+	{
+		using type = typename ConcatIndexList<typename MakeIndexList<N/2>::type, typename MakeIndexList<N - N/2>::type>::type;
+	};
+
+	template <> struct MakeIndexList<0>
+	{
+		using type = IndexList<>;
+	};
+
+	template <> struct MakeIndexList<1>
+	{
+		using type = IndexList<0>;
+	};
+
+	// lookup table for all 256 values of byte, Predicate::check(unsigned char) must be constexpr
+	template <typename Predicate, typename Indexes = typename MakeIndexList<256>::type> struct ByteTable;
+	template <typename Predicate> struct NegatedPredicate;
+
+	template <typename Predicate, size_t... I> struct ByteTable<Predicate, IndexList<I...>>
+	{
+		static const constexpr bool data[256]{Predicate::check(static_cast<unsigned char>(I))...};
+		using Negated = ByteTable<NegatedPredicate<Predicate>>;
+		static constexpr size_t count(size_t i = 0)
+		{
+			return i < 256 ? (Predicate::check(static_cast<unsigned char>(i)) ? 1 : 0) + count(i+1) : 0;
+		}
+		// n-th byte in table (counting from zero)
+		static constexpr unsigned char nth(size_t n, size_t i = 0)
+		{
+			return i >= 256 ? 0 : (Predicate::check(static_cast<unsigned char>(i)) ? (n == 0 ? static_cast<unsigned char>(i) : nth(n-1, i+1)) : nth(n, i+1));
+		}
+		// all bytes in table form one range [nth(0), nth(count()-1)]
+		static constexpr bool contiguous()
+		{
+			return count() > 0 && static_cast<size_t>(nth(count()-1)) - nth(0) + 1 == count();
+		}
+	};
+
+	template <typename Predicate> struct NegatedPredicate
+	{
+		static constexpr bool check(const unsigned char c)
+		{
+			return !Predicate::check(c);
+		}
+	};
+
+	template <typename Predicate, size_t... I> const constexpr bool ByteTable<Predicate, IndexList<I...>>::data[256];
+
+	template <unsigned char... bytes> struct ByteList { };
+
+	// search for any of few bytes, in NUL-terminated string returns pointer to found byte or to terminating NUL
+	template <typename Bytes> struct FindAnyOf;
+
+	template <unsigned char... bytes> struct FindAnyOf<ByteList<bytes...>>
+	{
+		static inline bool isOneOf(unsigned char c)
+		{
+			return isOneOfHelper(c, bytes...);
+		}
+		static inline const char * find(const char * str)
+		{
+			#if defined(SRX_SIMD_AVX2)
+			return findVector<__m256i, 32>(str);
+			#elif defined(SRX_SIMD_SSE2)
+			return findVector<__m128i, 16>(str);
+			#else
+			while (*str && !isOneOf(static_cast<unsigned char>(*str))) ++str;
+			return str;
+			#endif
+		}
+		// length-delimited variant (NUL is not special), returns end if nothing found
+		static inline const char * find(const char * str, const char * end)
+		{
+			#if defined(SRX_SIMD_AVX2)
+			str = findVector<__m256i, 32>(str, end);
+			#elif defined(SRX_SIMD_SSE2)
+			str = findVector<__m128i, 16>(str, end);
+			#endif
+			while (str != end && !isOneOf(static_cast<unsigned char>(*str))) ++str;
+			return str;
+		}
+		#if defined(SRX_SIMD_AVX2)
+		// bytes of block which are one of searched (0xFF) or not (0x00)
+		static inline __m256i matches(__m256i chunk)
+		{
+			return equalMask(chunk, _mm256_setzero_si256(), bytes...);
+		}
+		#elif defined(SRX_SIMD_SSE2)
+		static inline __m128i matches(__m128i chunk)
+		{
+			return equalMask(chunk, _mm_setzero_si128(), bytes...);
+		}
+		#endif
+	protected:
+		static inline bool isOneOfHelper(unsigned char) { return false; }
+		template <typename... Rest> static inline bool isOneOfHelper(unsigned char c, unsigned char first, Rest... rest)
+		{
+			return c == first || isOneOfHelper(c, rest...);
+		}
+		#if defined(SRX_SIMD_AVX2)
+		static inline __m256i equalMask(__m256i, __m256i acc) { return acc; }
+		template <typename... Rest> static inline __m256i equalMask(__m256i chunk, __m256i acc, unsigned char first, Rest... rest)
+		{
+			return equalMask(chunk, _mm256_or_si256(acc, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(static_cast<char>(first)))), rest...);
+		}
+		static inline uint32_t candidates(__m256i chunk)
+		{
+			return static_cast<uint32_t>(_mm256_movemask_epi8(equalMask(chunk, _mm256_setzero_si256(), bytes...)));
+		}
+		static inline uint32_t candidatesOrZero(__m256i chunk)
+		{
+			return static_cast<uint32_t>(_mm256_movemask_epi8(equalMask(chunk, _mm256_cmpeq_epi8(chunk, _mm256_setzero_si256()), bytes...)));
+		}
+		static inline __m256i load(const __m256i * ptr)
+		{
+			return _mm256_load_si256(ptr);
+		}
+		static inline __m256i loadUnaligned(const char * ptr)
+		{
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+		}
+		#elif defined(SRX_SIMD_SSE2)
+		static inline __m128i equalMask(__m128i, __m128i acc) { return acc; }
+		template <typename... Rest> static inline __m128i equalMask(__m128i chunk, __m128i acc, unsigned char first, Rest... rest)
+		{
+			return equalMask(chunk, _mm_or_si128(acc, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(static_cast<char>(first)))), rest...);
+		}
+		static inline uint32_t candidates(__m128i chunk)
+		{
+			return static_cast<uint32_t>(_mm_movemask_epi8(equalMask(chunk, _mm_setzero_si128(), bytes...)));
+		}
+		static inline uint32_t candidatesOrZero(__m128i chunk)
+		{
+			return static_cast<uint32_t>(_mm_movemask_epi8(equalMask(chunk, _mm_cmpeq_epi8(chunk, _mm_setzero_si128()), bytes...)));
+		}
+		static inline __m128i load(const __m128i * ptr)
+		{
+			return _mm_load_si128(ptr);
+		}
+		static inline __m128i loadUnaligned(const char * ptr)
+		{
+			return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		}
+		#endif
+		#if defined(SRX_SIMD_AVX2) || defined(SRX_SIMD_SSE2)
+		// aligned loads never cross page boundary so reading whole block around terminating NUL is safe
+		template <typename Vector, size_t width> static inline const char * findVector(const char * str)
+		{
+			const size_t misalign{reinterpret_cast<uintptr_t>(str) & (width-1)};
+			const Vector * block{reinterpret_cast<const Vector *>(str - misalign)};
+			uint32_t mask{candidatesOrZero(load(block)) >> misalign};
+			if (mask) return str + __builtin_ctz(mask);
+			for (;;)
+			{
+				++block;
+				mask = candidatesOrZero(load(block));
+				if (mask) return reinterpret_cast<const char *>(block) + __builtin_ctz(mask);
+			}
+		}
+		// returns found byte or position of unchecked tail (shorter than width)
+		template <typename Vector, size_t width> static inline const char * findVector(const char * str, const char * end)
+		{
+			while (static_cast<size_t>(end - str) >= width)
+			{
+				const uint32_t mask{candidates(loadUnaligned(str))};
+				if (mask) return str + __builtin_ctz(mask);
+				str += width;
+			}
+			return str;
+		}
+		#endif
+	};
+
+	// search in NUL-terminated string with lookup table (for bigger sets of bytes)
+	template <typename Table> struct FindInTable
+	{
+		static inline const char * find(const char * str)
+		{
+			while (*str && !Table::data[static_cast<unsigned char>(*str)]) ++str;
+			return str;
+		}
+		static inline const char * find(const char * str, const char * end)
+		{
+			while (str != end && !Table::data[static_cast<unsigned char>(*str)]) ++str;
+			return str;
+		}
+	};
+
+	// search for first byte in range [low, high] (or out of it when inside is false), vector variant compares whole block with two instructions
+	template <unsigned char low, unsigned char high, bool inside> struct FindInRange
+	{
+		static inline bool isSearched(unsigned char c)
+		{
+			return (c >= low && c <= high) == inside;
+		}
+		static inline const char * find(const char * str)
+		{
+			#if defined(SRX_SIMD_AVX2)
+			return findVector<__m256i, 32>(str);
+			#elif defined(SRX_SIMD_SSE2)
+			return findVector<__m128i, 16>(str);
+			#else
+			while (*str && !isSearched(static_cast<unsigned char>(*str))) ++str;
+			return str;
+			#endif
+		}
+		static inline const char * find(const char * str, const char * end)
+		{
+			#if defined(SRX_SIMD_AVX2)
+			str = findVector<__m256i, 32>(str, end);
+			#elif defined(SRX_SIMD_SSE2)
+			str = findVector<__m128i, 16>(str, end);
+			#endif
+			while (str != end && !isSearched(static_cast<unsigned char>(*str))) ++str;
+			return str;
+		}
+	protected:
+		#if defined(SRX_SIMD_AVX2)
+		static inline uint32_t candidates(__m256i chunk)
+		{
+			// byte - low <= high - low (unsigned) is test for both bounds
+			const __m256i shifted{_mm256_sub_epi8(chunk, _mm256_set1_epi8(static_cast<char>(low)))};
+			const uint32_t mask{static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8(static_cast<char>(high - low))), shifted)))};
+			return inside ? mask : ~mask;
+		}
+		static inline uint32_t candidatesOrZero(__m256i chunk)
+		{
+			return candidates(chunk) | static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_setzero_si256())));
+		}
+		static inline __m256i load(const __m256i * ptr)
+		{
+			return _mm256_load_si256(ptr);
+		}
+		static inline __m256i loadUnaligned(const char * ptr)
+		{
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+		}
+		#elif defined(SRX_SIMD_SSE2)
+		static inline uint32_t candidates(__m128i chunk)
+		{
+			const __m128i shifted{_mm_sub_epi8(chunk, _mm_set1_epi8(static_cast<char>(low)))};
+			const uint32_t mask{static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(static_cast<char>(high - low))), shifted)))};
+			return inside ? mask : (~mask & 0xFFFFu);
+		}
+		static inline uint32_t candidatesOrZero(__m128i chunk)
+		{
+			return candidates(chunk) | static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_setzero_si128())));
+		}
+		static inline __m128i load(const __m128i * ptr)
+		{
+			return _mm_load_si128(ptr);
+		}
+		static inline __m128i loadUnaligned(const char * ptr)
+		{
+			return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		}
+		#endif
+		#if defined(SRX_SIMD_AVX2) || defined(SRX_SIMD_SSE2)
+		template <typename Vector, size_t width> static inline const char * findVector(const char * str)
+		{
+			const size_t misalign{reinterpret_cast<uintptr_t>(str) & (width-1)};
+			const Vector * block{reinterpret_cast<const Vector *>(str - misalign)};
+			uint32_t mask{candidatesOrZero(load(block)) >> misalign};
+			if (mask) return str + __builtin_ctz(mask);
+			for (;;)
+			{
+				++block;
+				mask = candidatesOrZero(load(block));
+				if (mask) return reinterpret_cast<const char *>(block) + __builtin_ctz(mask);
+			}
+		}
+		template <typename Vector, size_t width> static inline const char * findVector(const char * str, const char * end)
+		{
+			while (static_cast<size_t>(end - str) >= width)
+			{
+				const uint32_t mask{candidates(loadUnaligned(str))};
+				if (mask) return str + __builtin_ctz(mask);
+				str += width;
+			}
+			return str;
+		}
+		#endif
+	};
+
+	// bytes which can be at i-th position of literal (Literal::check(i, byte) must be constexpr)
+	template <typename Literal, size_t i> struct LiteralPositionPredicate
+	{
+		static constexpr bool check(const unsigned char c)
+		{
+			return Literal::check(i, c);
+		}
+	};
+
+	// Boyer-Moore-Horspool shift for every byte (distance of its last occurrence before end of literal)
+	template <typename Literal, typename Indexes = typename MakeIndexList<256>::type> struct LiteralShiftTable;
+
+	template <typename Literal, size_t... I> struct LiteralShiftTable<Literal, IndexList<I...>>
+	{
+		static constexpr size_t shift(const unsigned char c, size_t i = 0)
+		{
+			return i + 1 >= Literal::length ? Literal::length : (Literal::check(Literal::length - 2 - i, c) ? i + 1 : shift(c, i + 1));
+		}
+		static const constexpr size_t data[256]{shift(static_cast<unsigned char>(I))...};
+	};
+
+	template <typename Literal, size_t... I> const constexpr size_t LiteralShiftTable<Literal, IndexList<I...>>::data[256];
+
+	template <typename Table, typename Indexes> struct TableBytes;
+
+	template <typename Table, size_t... I> struct TableBytes<Table, IndexList<I...>>
+	{
+		using Type = ByteList<Table::nth(I)...>;
+	};
+
+	// search for literal in length-delimited input, returns its first occurrence, beginning of its part at end of input or end
+	// blocks are filtered by first and last byte of literal (when they are few), rest of input is searched with Boyer-Moore-Horspool
+	template <typename Literal, typename First = ByteTable<LiteralPositionPredicate<Literal, 0>>, typename Last = ByteTable<LiteralPositionPredicate<Literal, (Literal::length ? Literal::length - 1 : 0)>>, bool vector = (First::count() <= 3 && Last::count() <= 3)> struct FindLiteral
+	{
+		static inline bool verifyPrefix(const char * str, const size_t length)
+		{
+			for (size_t i{0}; i != length; ++i) if (!Literal::check(i, static_cast<unsigned char>(str[i]))) return false;
+			return true;
+		}
+		static inline bool verify(const char * str)
+		{
+			return verifyPrefix(str, Literal::length);
+		}
+		static inline const char * find(const char * str, const char * end)
+		{
+			#if defined(SRX_SIMD_AVX2)
+			if (vector && findVector<__m256i, 32>(str, end)) return str;
+			#elif defined(SRX_SIMD_SSE2)
+			if (vector && findVector<__m128i, 16>(str, end)) return str;
+			#endif
+			while (static_cast<size_t>(end - str) >= Literal::length)
+			{
+				const unsigned char last{static_cast<unsigned char>(str[Literal::length - 1])};
+				if (Literal::check(Literal::length - 1, last) && verify(str)) return str;
+				str += LiteralShiftTable<Literal>::data[last];
+			}
+			// literal can continue after end (in next piece of stream)
+			while (str < end && !verifyPrefix(str, static_cast<size_t>(end - str))) ++str;
+			return str < end ? str : end;
+		}
+	protected:
+		using FirstBytes = FindAnyOf<typename TableBytes<First, typename MakeIndexList<(First::count() <= 3 ? First::count() : 0)>::type>::Type>;
+		using LastBytes = FindAnyOf<typename TableBytes<Last, typename MakeIndexList<(Last::count() <= 3 ? Last::count() : 0)>::type>::Type>;
+		#if defined(SRX_SIMD_AVX2)
+		static inline uint32_t candidates(const char * str)
+		{
+			const __m256i first{FirstBytes::matches(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(str)))};
+			const __m256i last{LastBytes::matches(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + Literal::length - 1)))};
+			return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(first, last)));
+		}
+		#elif defined(SRX_SIMD_SSE2)
+		static inline uint32_t candidates(const char * str)
+		{
+			const __m128i first{FirstBytes::matches(_mm_loadu_si128(reinterpret_cast<const __m128i *>(str)))};
+			const __m128i last{LastBytes::matches(_mm_loadu_si128(reinterpret_cast<const __m128i *>(str + Literal::length - 1)))};
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(first, last)));
+		}
+		#endif
+		#if defined(SRX_SIMD_AVX2) || defined(SRX_SIMD_SSE2)
+		// returns true when literal was found (str points to it), otherwise str points to unchecked tail
+		template <typename Vector, size_t width> static inline bool findVector(const char * & str, const char * end)
+		{
+			while (static_cast<size_t>(end - str) >= Literal::length - 1 + width)
+			{
+				for (uint32_t mask{candidates(str)}; mask; mask &= mask - 1)
+				{
+					const char * candidate{str + __builtin_ctz(mask)};
+					if (verify(candidate))
+					{
+						str = candidate;
+						return true;
+					}
+				}
+				str += width;
+			}
+			return false;
+		}
+		#endif
+	};
+
+	// select best searching strategy for set of bytes
+	template <typename Table, typename Indexes> struct SmallByteScanner;
+
+	template <typename Table, size_t... I> struct SmallByteScanner<Table, IndexList<I...>>
+	{
+		using Type = FindAnyOf<ByteList<Table::nth(I)...>>;
+	};
+
+	// bigger sets are searched as one range or as everything out of one range (e.g. first byte which isn't [a-z])
+	template <typename Table, typename Negated = typename Table::Negated, bool range = Table::contiguous(), bool outOfRange = Negated::contiguous()> struct LargeByteScanner
+	{
+		using Type = FindInTable<Table>;
+	};
+
+	template <typename Table, typename Negated, bool outOfRange> struct LargeByteScanner<Table, Negated, true, outOfRange>
+	{
+		using Type = FindInRange<Table::nth(0), Table::nth(Table::count()-1), true>;
+	};
+
+	template <typename Table, typename Negated> struct LargeByteScanner<Table, Negated, false, true>
+	{
+		using Type = FindInRange<Negated::nth(0), Negated::nth(Negated::count()-1), false>;
+	};
+
+	template <typename Table, size_t count = Table::count()> struct ByteScanner: LargeByteScanner<Table> { };
+
+	template <typename Table> struct ByteScanner<Table, 0>: SmallByteScanner<Table, IndexList<>> { };
+	template <typename Table> struct ByteScanner<Table, 1>: SmallByteScanner<Table, IndexList<0>> { };
+	template <typename Table> struct ByteScanner<Table, 2>: SmallByteScanner<Table, IndexList<0,1>> { };
+	template <typename Table> struct ByteScanner<Table, 3>: SmallByteScanner<Table, IndexList<0,1,2>> { };
+
+}
+
+#endif
@@ -0,0 +1,260 @@
+#include "regexp/pattern.hpp"
+#include "regexp/runtime.hpp"
+#include "src/random.hpp"
+#include <regex>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// benchmark of matching generated lines with compile-time regexp, runtime regexp and std::regex
+// every measurement is printed as one JSON object per line:
+// {"engine":"srx","pattern":"literal","corpus":"log","size":65536,"lines":..,"matches":..,"bytes_per_sec":..,"matches_per_sec":..,"ns_p50":..,"ns_p90":..,"ns_p99":..,"ns_max":..,"complete":true}
+// usage: bench [-s size]... [-t seconds] [-f pattern]
+
+using namespace SRX;
+using Clock = std::chrono::steady_clock;
+
+struct Options
+{
+	std::vector<size_t> sizes;
+	double minTime{0.2}; // throughput is measured at least this long
+	double maxTime{2.0}; // slow engine stops after this time (measurement isn't complete)
+	const char * filter{nullptr};
+};
+
+struct Corpus
+{
+	const char * name;
+	std::string data;
+	std::vector<std::pair<size_t, size_t>> lines;
+	void add(const std::string & line)
+	{
+		lines.emplace_back(data.size(), data.size() + line.size());
+		data.append(line);
+		data.push_back('\n');
+	}
+};
+
+// words with occasional literals, addresses and repeated words
+Corpus textCorpus(size_t size)
+{
+	Corpus corpus{"text", {}, {}};
+	Random random{1};
+	while (corpus.data.size() < size)
+	{
+		std::string line;
+		const unsigned int words{4 + random.next(16)};
+		for (unsigned int i{0}; i != words; ++i)
+		{
+			if (i) line.push_back(' ');
+			const unsigned int kind{random.next(40)};
+			if (kind == 0) line.append("GET /index");
+			else if (kind == 1) line.append("ERROR");
+			else if (kind == 2)
+			{
+				random.word(line, 2 + random.next(6));
+				line.push_back('@');
+				random.word(line, 2 + random.next(6));
+				line.append(".com");
+			}
+			else if (kind == 3 && i)
+			{
+				// repeat previous word
+				const size_t space{line.rfind(' ', line.size() - 2)};
+				line.append(line, space == std::string::npos ? 0 : space + 1, line.size() - 1 - (space == std::string::npos ? 0 : space + 1));
+			}
+			else random.word(line, 1 + random.next(9));
+		}
+		corpus.add(line);
+	}
+	return corpus;
+}
+
+// access-log-like lines: date, address, request, status, size, severity
+Corpus logCorpus(size_t size)
+{
+	static const char * const methods[] = {"GET", "POST", "PUT", "DELETE"};
+	static const char * const levels[] = {"INFO", "INFO", "INFO", "DEBUG", "WARN", "ERROR", "FATAL"};
+	Corpus corpus{"log", {}, {}};
+	Random random{2};
+	while (corpus.data.size() < size)
+	{
+		std::string line{"2015-"};
+		random.number(line, 2);
+		line.push_back('-');
+		random.number(line, 2);
+		line.push_back(' ');
+		random.number(line, 2);
+		line.push_back(':');
+		random.number(line, 2);
+		line.push_back(':');
+		random.number(line, 2);
+		line.push_back(' ');
+		for (unsigned int i{0}; i != 4; ++i)
+		{
+			if (i) line.push_back('.');
+			random.number(line, 1 + random.next(3));
+		}
+		line.push_back(' ');
+		line.append(methods[random.next(4)]);
+		line.append(" /");
+		random.word(line, 3 + random.next(8));
+		if (random.next(2)) line.append("/index");
+		line.append(".html ");
+		random.number(line, 3);
+		line.push_back(' ');
+		random.number(line, 1 + random.next(6));
+		line.push_back(' ');
+		line.append(levels[random.next(7)]);
+		line.push_back(' ');
+		random.word(line, 3 + random.next(6));
+		line.push_back('@');
+		random.word(line, 3 + random.next(6));
+		line.append(random.next(2) ? ".com" : ".org");
+		corpus.add(line);
+	}
+	return corpus;
+}
+
+// long runs which make backtracking engines try many ways (mostly without match)
+Corpus adversarialCorpus(size_t size)
+{
+	Corpus corpus{"adversarial", {}, {}};
+	Random random{3};
+	while (corpus.data.size() < size)
+	{
+		std::string line(12 + random.next(10), 'a');
+		const unsigned int kind{random.next(8)};
+		if (kind == 0) line.push_back('b');
+		else if (kind == 1) line.append(" " + line);
+		else if (kind == 2) line.append("@aaaa.co");
+		corpus.add(line);
+	}
+	return corpus;
+}
+
+struct Measurement
+{
+	size_t lines{0};
+	size_t matches{0};
+	size_t found{0}; // matching lines in one pass
+	size_t bytes{0};
+	double seconds{0};
+	bool complete{true};
+	std::vector<double> latencies;
+};
+
+static double since(Clock::time_point start)
+{
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// first pass times every line (latency), next passes over whole corpus measure throughput
+template <typename Matcher> Measurement measure(const Corpus & corpus, const Options & options, Matcher && matcher)
+{
+	Measurement result;
+	const char * data{corpus.data.data()};
+	const Clock::time_point start{Clock::now()};
+	for (const auto & line: corpus.lines)
+	{
+		const Clock::time_point before{Clock::now()};
+		const bool matched{matcher(data + line.first, data + line.second)};
+		result.latencies.push_back(std::chrono::duration<double, std::nano>(Clock::now() - before).count());
+		result.matches += matched;
+		result.lines++;
+		result.bytes += line.second - line.first + 1;
+		if (since(start) > options.maxTime)
+		{
+			result.complete = false;
+			break;
+		}
+	}
+	result.seconds = since(start);
+	result.found = result.matches;
+	if (!result.complete) return result;
+
+	const size_t bytes{result.bytes}, lines{result.lines};
+	result.bytes = result.lines = result.matches = 0;
+	const Clock::time_point throughput{Clock::now()};
+	do
+	{
+		// matches are counted, so matching can't be optimized out
+		for (const auto & line: corpus.lines) result.matches += matcher(data + line.first, data + line.second);
+		result.bytes += bytes;
+		result.lines += lines;
+	}
+	while (since(throughput) < options.minTime);
+	result.seconds = since(throughput);
+	return result;
+}
+
+static double percentile(std::vector<double> & sorted, double fraction)
+{
+	if (sorted.empty()) return 0;
+	return sorted[std::min(sorted.size() - 1, static_cast<size_t>(fraction * static_cast<double>(sorted.size())))];
+}
+
+void report(const char * engine, const char * pattern, const Corpus & corpus, Measurement & result, long expected)
+{
+	std::sort(result.latencies.begin(), result.latencies.end());
+	const double seconds{result.seconds > 0 ? result.seconds : 1e-9};
+	printf("{\"engine\":\"%s\",\"pattern\":\"%s\",\"corpus\":\"%s\",\"size\":%zu,\"lines\":%zu,\"matches\":%zu,", engine, pattern, corpus.name, corpus.data.size(), result.lines, result.matches);
+	printf("\"bytes_per_sec\":%.0f,\"matches_per_sec\":%.0f,", static_cast<double>(result.bytes) / seconds, static_cast<double>(result.matches) / seconds);
+	printf("\"ns_p50\":%.0f,\"ns_p90\":%.0f,\"ns_p99\":%.0f,\"ns_max\":%.0f,", percentile(result.latencies, 0.5), percentile(result.latencies, 0.9), percentile(result.latencies, 0.99), result.latencies.empty() ? 0.0 : result.latencies.back());
+	// different number of matching lines than std::regex found (when both finished whole corpus)
+	printf("\"complete\":%s,\"mismatch\":%s}\n", result.complete ? "true" : "false", expected >= 0 && result.complete && result.found != static_cast<size_t>(expected) ? "true" : "false");
+	fflush(stdout);
+}
+
+template <typename Regexp> void benchmark(const char * name, const char * pattern, const std::vector<Corpus> & corpora, const Options & options)
+{
+	if (options.filter && strcmp(options.filter, name)) return;
+	Regexp regexp;
+	RuntimeRegularExpression runtime{pattern};
+	const std::regex reference{pattern};
+	for (const auto & corpus: corpora)
+	{
+		Measurement stl{measure(corpus, options, [&](const char * begin, const char * end) { return std::regex_search(begin, end, reference); })};
+		const long expected{stl.complete ? static_cast<long>(stl.found) : -1};
+		Measurement compiled{measure(corpus, options, [&](const char * begin, const char * end) { return regexp(begin, end); })};
+		report("srx", name, corpus, compiled, expected);
+		Measurement interpreted{measure(corpus, options, [&](const char * begin, const char * end) { return runtime(begin, end); })};
+		report("srx-runtime", name, corpus, interpreted, expected);
+		report("std::regex", name, corpus, stl, -1);
+	}
+}
+
+int main (int argc, char ** argv)
+{
+	Options options;
+	for (int i{1}; i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "-s") && i + 1 < argc) options.sizes.push_back(static_cast<size_t>(atol(argv[++i])));
+		else if (!strcmp(argv[i], "-t") && i + 1 < argc) options.minTime = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-f") && i + 1 < argc) options.filter = argv[++i];
+		else
+		{
+			fprintf(stderr,"usage: %s [-s size]... [-t seconds] [-f pattern]\n",argv[0]);
+			return 1;
+		}
+	}
+	if (options.sizes.empty()) options.sizes = {64 * 1024, 1024 * 1024};
+
+	for (size_t size: options.sizes)
+	{
+		const std::vector<Corpus> corpora{textCorpus(size), logCorpus(size), adversarialCorpus(size)};
+		benchmark<SRX_REGEXP("GET /index")>("literal", "GET /index", corpora, options);
+		benchmark<SRX_REGEXP("[0-9]+\\.[0-9]+\\.[0-9]+\\.[0-9]+")>("class", "[0-9]+\\.[0-9]+\\.[0-9]+\\.[0-9]+", corpora, options);
+		benchmark<SRX_REGEXP("^[0-9]{4}-[0-9]{2}-[0-9]{2} ")>("anchored", "^[0-9]{4}-[0-9]{2}-[0-9]{2} ", corpora, options);
+		benchmark<SRX_REGEXP("ERROR|FATAL|WARN|DEBUG")>("selection", "ERROR|FATAL|WARN|DEBUG", corpora, options);
+		benchmark<SRX_REGEXP("(a+)+b")>("nested", "(a+)+b", corpora, options);
+		benchmark<SRX_REGEXP("([a-z]+)@([a-z]+)\\.com")>("catch", "([a-z]+)@([a-z]+)\\.com", corpora, options);
+		benchmark<SRX_REGEXP("([a-z]+) \\1")>("back-reference", "([a-z]+) \\1", corpora, options);
+	}
+	return 0;
+}
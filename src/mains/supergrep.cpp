@@ -1,55 +1,185 @@
 #include "regexp/regexp.hpp"
 #include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <memory>
 #include <iostream>
-#include <fstream> 
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 using namespace SRX;
 
 #define INSERT_HERE Any
 
-int main (int argc, char ** argv)
+using Regexp = RegularExpression< Selection<Str<'A','B','C','D','E'>,Str<'D','E','F','G','H'>,Str<'E','F','G','H','I'>,Repeat<4,0,Chr<'A'>>>
+ >;
+
+// size of one piece of work for thread (chunks are aligned to end of line)
+static const size_t chunkSize{4*1024*1024};
+
+struct MappedFile
 {
-	RegularExpression< Selection<Str<'A','B','C','D','E'>,Str<'D','E','F','G','H'>,Str<'E','F','G','H','I'>,Repeat<4,0,Chr<'A'>>>
- > regexp;
-	
-	if (argc == 2)
+	const char * data{nullptr};
+	size_t size{0};
+	MappedFile(const char * fname)
 	{
-		std::ifstream ifs (std::string(argv[1]), std::ifstream::in);
+		int fd{open(fname, O_RDONLY)};
+		if (fd < 0) return;
+		struct stat info;
+		if (fstat(fd, &info) == 0 && info.st_size > 0)
+		{
+			void * ptr{mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0)};
+			if (ptr != MAP_FAILED)
+			{
+				madvise(ptr, info.st_size, MADV_SEQUENTIAL);
+				data = static_cast<const char *>(ptr);
+				size = info.st_size;
+			}
+		}
+		close(fd);
+	}
+	~MappedFile()
+	{
+		if (data) munmap(const_cast<char *>(data), size);
+	}
+	MappedFile(const MappedFile &) = delete;
+	MappedFile & operator=(const MappedFile &) = delete;
+};
 
-		char buffer[1024];
-		//std::string line;
+// split input to line-aligned pieces
+std::vector<std::pair<const char *, const char *>> splitToChunks(const char * begin, const char * end)
+{
+	std::vector<std::pair<const char *, const char *>> chunks;
+	while (begin != end)
+	{
+		const char * last{begin + std::min(chunkSize, static_cast<size_t>(end - begin))};
+		if (last != end)
+		{
+			const char * eol{static_cast<const char *>(memchr(last, '\n', end - last))};
+			last = eol ? eol + 1 : end;
+		}
+		chunks.emplace_back(begin, last);
+		begin = last;
+	}
+	return chunks;
+}
+
+void grepChunk(Regexp & regexp, const char * begin, const char * end, const std::string & prefix, std::string & output)
+{
+	while (begin != end)
+	{
+		const char * eol{static_cast<const char *>(memchr(begin, '\n', end - begin))};
+		const char * last{eol ? eol : end};
+		if (regexp(begin, last))
+		{
+			output.append(prefix);
+			output.append(begin, last);
+			output.push_back('\n');
+		}
+		begin = eol ? eol + 1 : end;
+	}
+}
 
-		while (ifs.getline(buffer,1024))
+// every thread has own regexp (it contains state of matching), output is written in original order
+bool grepFile(const char * fname, const std::string & prefix, unsigned int threadCount)
+{
+	MappedFile file{fname};
+	if (!file.data)
+	{
+		std::ifstream ifs (fname, std::ifstream::in);
+		if (!ifs) return false;
+		// empty file or something which can't be mapped
+		Regexp regexp;
+		std::string line;
+		while (getline(ifs,line))
 		{
-			if (regexp(buffer))
+			if (regexp(line)) std::cout << prefix << line << '\n';
+		}
+		return true;
+	}
+
+	const auto chunks = splitToChunks(file.data, file.data + file.size);
+	std::vector<std::string> outputs(chunks.size());
+	std::unique_ptr<std::atomic<bool>[]> done{new std::atomic<bool>[chunks.size()]};
+	for (size_t i{0}; i != chunks.size(); ++i) done[i] = false;
+	std::atomic<size_t> next{0};
+	std::mutex mutex;
+	std::condition_variable finished;
+
+	std::vector<std::thread> workers;
+	for (unsigned int t{0}; t < std::max(1u, threadCount); ++t)
+	{
+		workers.emplace_back([&]{
+			Regexp regexp;
+			for (size_t i{next++}; i < chunks.size(); i = next++)
 			{
-				std::cout << buffer << '\n';
+				grepChunk(regexp, chunks[i].first, chunks[i].second, prefix, outputs[i]);
+				std::lock_guard<std::mutex> lock{mutex};
+				done[i] = true;
+				finished.notify_one();
 			}
+		});
+	}
+
+	for (size_t i{0}; i != chunks.size(); ++i)
+	{
+		{
+			std::unique_lock<std::mutex> lock{mutex};
+			finished.wait(lock, [&]{ return done[i].load(); });
 		}
+		std::cout.write(outputs[i].data(), outputs[i].size());
+		std::string{}.swap(outputs[i]);
 	}
-	else if (argc >= 2)
+
+	for (auto & worker: workers) worker.join();
+	return true;
+}
+
+int main (int argc, char ** argv)
+{
+	std::ios_base::sync_with_stdio(false);
+	unsigned int threadCount{std::thread::hardware_concurrency()};
+	int first{1};
+
+	// -jN sets number of threads
+	if (argc >= 2 && !strncmp(argv[1], "-j", 2))
+	{
+		threadCount = static_cast<unsigned int>(atoi(argv[1]+2));
+		first = 2;
+	}
+
+	if (argc - first == 1)
 	{
-		for (int i = 1; i < argc; ++i)
+		if (!grepFile(argv[first], "", threadCount))
 		{
-			std::string fname{std::string(argv[i])};
-			std::ifstream ifs (fname, std::ifstream::in);
-	
-			char buffer[1024];
-			//std::string line;
-	
-			while (ifs.getline(buffer,1024))
+			fprintf(stderr,"can't open file '%s'\n",argv[first]);
+			return 1;
+		}
+	}
+	else if (argc - first >= 2)
+	{
+		for (int i = first; i < argc; ++i)
+		{
+			if (!grepFile(argv[i], std::string(argv[i]) + ": ", threadCount))
 			{
-				if (regexp(buffer))
-				{
-					std::cout << fname << ": " << buffer << '\n';
-				}
+				fprintf(stderr,"can't open file '%s'\n",argv[i]);
 			}
 		}
 	}
 	else
 	{
+		Regexp regexp;
 		std::string line;
-	
+
 		while (getline(std::cin,line))
 		{
 			if (regexp(line))
@@ -58,6 +188,6 @@ int main (int argc, char ** argv)
 			}
 		}
 	}
-	
+
 	return 0;
 }
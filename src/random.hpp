@@ -0,0 +1,37 @@
+#ifndef __SRC__RANDOM__HPP__
+#define __SRC__RANDOM__HPP__
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// deterministic pseudo-random input (same on every run) for benchmark and differential tests
+struct Random
+{
+	uint32_t seed;
+	explicit Random(uint32_t lseed): seed{lseed} { }
+	unsigned int next(unsigned int count)
+	{
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % count;
+	}
+	// shorter than limit, only characters from alphabet
+	std::string input(const char * alphabet, unsigned int limit)
+	{
+		std::string output;
+		const unsigned int length{next(limit)};
+		const unsigned int size{static_cast<unsigned int>(strlen(alphabet))};
+		for (unsigned int i{0}; i != length; ++i) output.push_back(alphabet[next(size)]);
+		return output;
+	}
+	void word(std::string & output, unsigned int length)
+	{
+		for (unsigned int i{0}; i != length; ++i) output.push_back(static_cast<char>('a' + next(26)));
+	}
+	void number(std::string & output, unsigned int digits)
+	{
+		for (unsigned int i{0}; i != digits; ++i) output.push_back(static_cast<char>('0' + next(10)));
+	}
+};
+
+#endif
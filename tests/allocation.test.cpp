@@ -0,0 +1,96 @@
+#include "regexp/regexp.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace SRX;
+
+static unsigned long allocations{0};
+
+void * operator new(size_t size)
+{
+	++allocations;
+	if (void * ptr = malloc(size)) return ptr;
+	throw std::bad_alloc{};
+}
+
+void operator delete(void * ptr) noexcept
+{
+	free(ptr);
+}
+
+// cycle saves only states of catches inside (not snapshots of inner cycles), so regexp grows linearly with nesting
+template <unsigned int depth> struct Nested
+{
+	using Type = Star<Opt<typename Nested<depth - 1>::Type>>;
+};
+template <> struct Nested<0>
+{
+	using Type = ArenaCatch<1, Chr<'a'>>;
+};
+template <unsigned int depth> using NestedRegexp = RegularExpression<typename Nested<depth>::Type>;
+static_assert(sizeof(NestedRegexp<4>) - sizeof(NestedRegexp<3>) == sizeof(NestedRegexp<3>) - sizeof(NestedRegexp<2>), "size of regexp grows linearly with nesting of cycles");
+
+using Words = RegularExpression<Begin, Plus<DynamicCatch<1, Plus<CRange<'a','z'>>>, Chr<' '>>, DynamicCatch<2, Plus<Number>>, End>;
+
+bool steadyState()
+{
+	const Words regexp;
+	Words::Results results;
+	const std::string input{"get post put head options 123"};
+	if (!regexp.match(input, results)) return false;
+	// buffers of catches (and their snapshots) are reused in next matches
+	allocations = 0;
+	for (unsigned int i{0}; i != 100; ++i)
+	{
+		if (!regexp.match(input, results)) return false;
+	}
+	if (allocations != 0) return false;
+	if (results.getCatch<1>().size() != 5 || results.getCatch<2>().size() != 1) return false;
+	if (results.part<1>(input, 4) != "options") return false;
+	return true;
+}
+
+bool moreSuccessfulContinuations()
+{
+	// continuation succeeds after every cycle, catch from the longest cycle is kept
+	RegularExpression<Begin, Star<Chr<'a'>>, DynamicCatch<1, Star<Chr<'a'>>>, End> regexp;
+	if (!regexp("aaaa")) return false;
+	if (regexp.getCatch<1>().size() != 1) return false;
+	if (regexp.getCatch<1>()[0].begin != 4 || regexp.getCatch<1>()[0].length != 0) return false;
+	return true;
+}
+
+bool boundedCycle()
+{
+	// catch in cycle with max has static storage, even first match doesn't allocate
+	RegularExpression<Begin, Repeat<1, 4, DynamicCatch<1, Plus<CRange<'a','z'>>>, Chr<' '>>, DynamicCatch<2, Plus<Number>>, End> regexp;
+	allocations = 0;
+	if (!regexp("get post put 123")) return false;
+	if (allocations != 0) return false;
+	return regexp.getCatch<1>().size() == 3 && regexp.getCatch<2>().size() == 1;
+}
+
+bool arena()
+{
+	// catches in arena are reclaimed with next match, snapshots in cycles don't copy them
+	RegularExpression<Plus<Chr<'/'>, ArenaCatch<1, Plus<NegSet<'/'>>>>, Chr<'/'>, ArenaCatch<2, Plus<CRange<'a','z'>>>, Str<'.','t','x','t'>, End> regexp;
+	const std::string input{"/usr/share/doc/a/b/c/file.txt"};
+	if (!regexp.match(input)) return false;
+	allocations = 0;
+	for (unsigned int i{0}; i != 100; ++i)
+	{
+		if (!regexp.match(input)) return false;
+	}
+	if (allocations != 0) return false;
+	return regexp.getCatch<1>().size() == 6 && regexp.part<1>(input, 5) == "c" && regexp.part<2>(input) == "file";
+}
+
+int main ()
+{
+	if (!steadyState()) return 1;
+	if (!boundedCycle()) return 1;
+	if (!arena()) return 1;
+	if (!moreSuccessfulContinuations()) return 1;
+	return 0;
+}
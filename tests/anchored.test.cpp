@@ -0,0 +1,54 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+static_assert(AnchoredAtBegin<Sequence<Begin, Chr<'a'>>>::value, "leading Begin is anchor");
+static_assert(AnchoredAtBegin<Sequence<Id<1,1>, DynamicCatch<1, Begin, Chr<'a'>>>>::value, "identifier and catch don't change anchor");
+static_assert(AnchoredAtBegin<Sequence<Selection<Seq<Begin, Chr<'a'>>, Seq<Begin, Chr<'b'>>>>>::value, "every option begins with Begin");
+static_assert(!AnchoredAtBegin<Sequence<Selection<Seq<Begin, Chr<'a'>>, Chr<'b'>>>>::value, "second option can match anywhere");
+static_assert(!AnchoredAtBegin<Sequence<Chr<'a'>, Begin>>::value, "Begin isn't first");
+
+// anchored regexp (DFA and backtracking) must give same result as regexp without fast path
+template <typename... Definition> bool sameResults(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Begin, Definition...> dfa;
+	const RegularExpression<Begin, Id<1,1>, Definition...> backtracking{};
+	const RegularExpression<Selection<Seq<Begin, Definition...>, Seq<Begin, Definition...>>, Id<1,1>> selection{};
+	typename RegularExpression<Begin, Id<1,1>, Definition...>::Results results;
+	typename RegularExpression<Selection<Seq<Begin, Definition...>, Seq<Begin, Definition...>>, Id<1,1>>::Results selectionResults;
+	return forRandomInputs(alphabet, 12, count, [&](const std::string & input)
+	{
+		const bool expected{backtracking.match(input, results)};
+		if (dfa(input) != expected || dfa(input.c_str()) != expected || selection.match(input, selectionResults) != expected) return false;
+		return !expected || (results.position() == 0 && selectionResults.length() == results.length());
+	});
+}
+
+bool differential()
+{
+	if (!sameResults<Plus<CRange<'a','z'>>, Chr<'='>>("ab=", 2000)) return false;
+	if (!sameResults<Star<Any>, Chr<'x'>, End>("xy", 2000)) return false;
+	if (!sameResults<Opt<Chr<'-'>>, Plus<Number>, End>("-1a", 2000)) return false;
+	if (!sameResults<End>("a", 100)) return false;
+	return true;
+}
+
+bool onlyFirstPosition()
+{
+	// findAll continues at end of first match, Begin can't match there
+	const RegularExpression<Begin, Str<'a','b','c'>> regexp{};
+	const std::string input{"abcabcabc"};
+	unsigned int count{0};
+	for (const auto & match: regexp.findAll(input)) if (match.position() != 0 || ++count > 1) return false;
+	if (count != 1) return false;
+	if (regexp.findAll(std::string{"xabc"}).begin() != regexp.findAll(std::string{"xabc"}).end()) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!onlyFirstPosition()) return 1;
+	return 0;
+}
@@ -0,0 +1,55 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+static_assert(UsesArena<Sequence<Star<Chr<'/'>, ArenaCatch<1, Plus<Any>>>>>::value, "catch in arena inside cycle");
+static_assert(!UsesArena<Sequence<Star<Chr<'/'>, DynamicCatch<1, Plus<Any>>>>>::value, "dynamic catch has own memory");
+
+template <unsigned int id, typename Arena, typename Dynamic> bool sameCatches(Arena & arena, Dynamic & dynamic)
+{
+	return sameCatches(arena.template getCatch<id>(), dynamic.template getCatch<id>());
+}
+
+// catches in arena must be same as catches in dynamic memory
+template <template <unsigned int, typename...> class Catch> using Segments = RegularExpression<Plus<Chr<'/'>, Catch<1, Plus<NegSet<'/'>>>>, Opt<Chr<'?'>, Catch<2, Star<Any>>>, End>;
+template <template <unsigned int, typename...> class Catch> using Pairs = RegularExpression<Id<1,1>, Star<Catch<1, Plus<CRange<'a','b'>>>, Chr<'='>, Catch<2, Star<CRange<'a','b'>>>, Chr<','>>, Catch<3, ReCatch<1>>>;
+
+template <typename Arena, typename Dynamic> bool sameAsDynamic(const char * alphabet, unsigned int count)
+{
+	Arena arena;
+	Dynamic dynamic;
+	typename Arena::Results results;
+	return forRandomInputs(alphabet, 40, count, [&](const std::string & input)
+	{
+		const bool expected{dynamic.match(input)};
+		if (arena.match(input) != expected || static_cast<const Arena &>(arena).match(input, results) != expected) return false;
+		return !expected || (sameCatches<1>(arena, dynamic) && sameCatches<2>(arena, dynamic) && sameCatches<3>(arena, dynamic) && sameCatches<1>(results, dynamic));
+	});
+}
+
+bool differential()
+{
+	if (!sameAsDynamic<Segments<ArenaCatch>, Segments<DynamicCatch>>("ab/?", 3000)) return false;
+	if (!sameAsDynamic<Pairs<ArenaCatch>, Pairs<DynamicCatch>>("ab=,", 3000)) return false;
+	return true;
+}
+
+// copy of regexp doesn't refer to arena of original
+bool copy()
+{
+	Segments<ArenaCatch> regexp;
+	if (!regexp.match(std::string{"/usr/share"}) || regexp.getCatch<1>().size() != 2) return false;
+	Segments<ArenaCatch> other{regexp};
+	if (other.getCatch<1>().size() != 0) return false;
+	other = regexp;
+	if (other.getCatch<1>().size() != 0) return false;
+	return other.match(std::string{"/a/b/c"}) && other.getCatch<1>().size() == 3 && regexp.getCatch<1>().size() == 2;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!copy()) return 1;
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include "regexp/pattern.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+using Stars = Seq<Id<1,1>, Star<Chr<'a'>>, Star<Chr<'a'>>, Star<Chr<'a'>>, Star<Chr<'a'>>, Star<Chr<'a'>>, Star<Chr<'a'>>, Chr<'b'>>;
+
+static_assert(!HasBackReference<Sequence<Stars>>::value, "no back-reference");
+static_assert(HasBackReference<Sequence<OneCatch<1, Plus<Chr<'a'>>>, Opt<ReCatch<1>>>>::value, "back-reference inside of optional part");
+
+// failed tries are remembered, so polynomial backtracking is linear
+bool pathological()
+{
+	const std::string input(400, 'a');
+	RegularExpression<Stars> regexp;
+	Backtracking limits;
+	if (regexp.match(input, limits) != MatchStatus::NoMatch) return false;
+	// tries and scanned characters
+	if (limits.steps > 20 * (input.size() + 1)) return false;
+	if (regexp.match(input + "b", limits) != MatchStatus::Match || regexp.length() != input.size() + 1) return false;
+	return true;
+}
+
+// cycle inside of cycle doesn't scan whole run again from every start of match (scanned characters are counted as steps)
+bool nested()
+{
+	RegularExpression<Id<1,1>, Star<Plus<Chr<'a'>>>, Chr<'b'>> regexp;
+	Backtracking limits;
+	if (regexp.match(std::string(10000, 'a'), limits) != MatchStatus::NoMatch) return false;
+	const size_t small{limits.steps};
+	if (regexp.match(std::string(80000, 'a'), limits) != MatchStatus::NoMatch) return false;
+	// eight times longer input takes about eight times more steps (quadratic would be 64 times)
+	if (small < 10000 || limits.steps > 9 * small) return false;
+	// inner cycle gives back character to continuation, so match begins at first character (as in PCRE)
+	RegularExpression<Id<1,1>, Star<Plus<Chr<'a'>>>, Str<'a','b'>> second;
+	return second.match(std::string{"aaab"}, limits) == MatchStatus::Match && second.position() == 0 && second.length() == 4 && second(std::string{"aaab"}) && second.position() == 0;
+}
+
+// cycle over part which can match empty string ends after empty cycle
+bool emptyCycles()
+{
+	Backtracking limits;
+	SRX_REGEXP("(a*)*b") stars;
+	if (stars.match(std::string(1000, 'a'), limits) != MatchStatus::NoMatch) return false;
+	if (stars.match(std::string(1000, 'a') + "b", limits) != MatchStatus::Match || stars.length() != 1001) return false;
+	SRX_REGEXP("([ab]*)+") plus;
+	if (plus.match(std::string{"baacabab"}, limits) != MatchStatus::Match || plus.position() != 0 || plus.length() != 3) return false;
+	// inner part which matches only one way
+	RegularExpression<Star<Begin>, Chr<'x'>> begins;
+	return begins.match(std::string{"yx"}, limits) == MatchStatus::Match && begins.position() == 1;
+}
+
+// without memoization budget is exceeded
+bool budget()
+{
+	const std::string input(400, 'a');
+	RegularExpression<Stars> regexp;
+	Backtracking limits{10000, false};
+	if (regexp.match(input, limits) != MatchStatus::BudgetExceeded || !limits.exceeded) return false;
+	// small input fits into budget
+	if (regexp.match("aaab", limits) != MatchStatus::Match) return false;
+	Backtracking memoized{10000};
+	if (regexp.match(input, memoized) != MatchStatus::NoMatch) return false;
+	return true;
+}
+
+// memoized matching must find same span and catches as normal matching
+template <typename... Definition> bool sameAsNormal(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Definition...> normal;
+	RegularExpression<Definition...> memoized;
+	typename RegularExpression<Definition...>::Results results;
+	Backtracking limits;
+	return forRandomInputs(alphabet, 40, count, [&](const std::string & input)
+	{
+		const bool expected{normal.match(input)};
+		if ((memoized.match(input, limits) == MatchStatus::Match) != expected || (memoized.match(input, results, limits) == MatchStatus::Match) != expected) return false;
+		if (!expected) return true;
+		return memoized.position() == normal.position() && memoized.length() == normal.length() && results.position() == normal.position() && sameCatches(memoized.template getCatch<1>(), normal.template getCatch<1>());
+	});
+}
+
+bool differential()
+{
+	if (!sameAsNormal<OneCatch<1, Star<Sel<Str<'a','b'>, Chr<'a'>>>>, Chr<'b'>>("ab", 2000)) return false;
+	if (!sameAsNormal<Plus<OneCatch<1, Plus<CRange<'a','b'>>>, Chr<','>>, Chr<'c'>>("ab,c", 2000)) return false;
+	if (!sameAsNormal<Begin, OneCatch<1, Star<Any>>, Sel<Str<'x','y'>, Chr<'y'>>, Star<Any>, End>("xyz", 2000)) return false;
+	// back-reference isn't memoized
+	if (!sameAsNormal<OneCatch<1, Plus<CRange<'a','b'>>>, Chr<'-'>, ReCatch<1>>("ab-", 2000)) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!pathological()) return 1;
+	if (!nested()) return 1;
+	if (!emptyCycles()) return 1;
+	if (!budget()) return 1;
+	if (!differential()) return 1;
+	return 0;
+}
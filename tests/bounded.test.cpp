@@ -0,0 +1,67 @@
+#include "regexp/regexp.hpp"
+#include <cstdio>
+
+using namespace SRX;
+
+bool insideBuffer()
+{
+	// "abc" is followed by other data, there is no NUL after it
+	const char buffer[] = {'x','a','b','c','d','e','f'};
+	RegularExpression<Begin, Str<'a','b','c'>, End> regexp;
+	if (!regexp(buffer+1, 3)) return false;
+	if (regexp(buffer+1, 4)) return false;
+	if (regexp(buffer, buffer+4)) return false;
+	return true;
+}
+
+bool binaryData()
+{
+	const std::string input{"ab\0cd", 5};
+	RegularExpression<Chr<'\0'>, Str<'c','d'>> regexp;
+	if (!regexp(input)) return false;
+	if (regexp(input.c_str())) return false;
+	RegularExpression<Begin, Plus<Any>, End> whole;
+	if (!whole(input)) return false;
+	return true;
+}
+
+bool catches()
+{
+	const char buffer[] = {'k','e','y','=','v','a','l','u','e',';','n','e','x','t'};
+	RegularExpression<Begin, OneCatch<1, Plus<CRange<'a','z'>>>, Chr<'='>, OneCatch<2, Plus<CRange<'a','z'>>>, End> regexp;
+	if (!regexp(buffer, 9)) return false;
+	if (regexp.getCatch<1>()[0].begin != 0 || regexp.getCatch<1>()[0].length != 3) return false;
+	if (regexp.getCatch<2>()[0].begin != 4 || regexp.getCatch<2>()[0].length != 5) return false;
+	return true;
+}
+
+bool skipping()
+{
+	const char buffer[] = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxABCD";
+	RegularExpression<Str<'A','B','C','D'>> regexp;
+	if (!regexp(buffer, sizeof(buffer)-1)) return false;
+	// match is just after end of input
+	if (regexp(buffer, sizeof(buffer)-2)) return false;
+	if (regexp(buffer, size_t{0})) return false;
+	RegularExpression<Star<Chr<'a'>>> empty;
+	if (!empty(buffer, size_t{0})) return false;
+	return true;
+}
+
+bool wide()
+{
+	const std::wstring input{L"ab\0cd", 5};
+	RegularExpression<Chr<L'\0'>, Str<L'c',L'd'>> regexp;
+	if (!regexp(input)) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!insideBuffer()) return 1;
+	if (!binaryData()) return 1;
+	if (!catches()) return 1;
+	if (!skipping()) return 1;
+	if (!wide()) return 1;
+	return 0;
+}
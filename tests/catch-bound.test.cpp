@@ -0,0 +1,61 @@
+#include "regexp/regexp.hpp"
+#include <cstdio>
+
+using namespace SRX;
+
+static_assert(std::is_same<SizedCatches<Sequence<DynamicCatch<1, Chr<'a'>>>, 1>::Type, Sequence<CatchContent<1, StaticMemory<1>, Chr<'a'>>>>::value, "catch outside of cycle is stored once");
+static_assert(std::is_same<SizedCatches<Repeat<1, 2, Repeat<0, 4, DynamicCatch<1, Chr<'a'>>>>, 1>::Type, Repeat<1, 2, Repeat<0, 4, CatchContent<1, StaticMemory<8>, Chr<'a'>>>>>::value, "bounds of nested cycles are multiplied");
+static_assert(std::is_same<SizedCatches<Star<DynamicCatch<1, Chr<'a'>>>, 1>::Type, Star<DynamicCatch<1, Chr<'a'>>>>::value, "catch in unbounded cycle stays dynamic");
+static_assert(std::is_same<SizedCatches<Repeat<0, 100, DynamicCatch<1, Chr<'a'>>>, 1>::Type, Repeat<0, 100, DynamicCatch<1, Chr<'a'>>>>::value, "big bound stays dynamic");
+static_assert(std::is_same<SizedCatches<Repeat<0, 16, Repeat<0, 16, DynamicCatch<1, Chr<'a'>>>>, 1>::Type, Repeat<0, 16, Repeat<0, 16, DynamicCatch<1, Chr<'a'>>>>>::value, "product of small bounds over limit stays dynamic");
+static_assert(std::is_same<SizedCatches<Repeat<0, 4, Repeat<0, 4, DynamicCatch<1, Chr<'a'>>>>, 1>::Type, Repeat<0, 4, Repeat<0, 4, CatchContent<1, StaticMemory<16>, Chr<'a'>>>>>::value, "product at limit is static");
+static_assert(CycleBound<staticCatchLimit, ~0u>::value == 0, "product doesn't overflow");
+static_assert(std::is_same<SizedCatches<Repeat<0, 3, StaticCatch<1, 2, DynamicCatch<2, Chr<'a'>>>>, 1>::Type, Repeat<0, 3, StaticCatch<1, 2, CatchContent<2, StaticMemory<3>, Chr<'a'>>>>>::value, "memory chosen by user is kept");
+
+template <unsigned int id, typename Regexp> bool catches(Regexp & regexp, std::initializer_list<Catch> expected)
+{
+	const CatchReturn found{regexp.template getCatch<id>()};
+	if (found.size() != expected.size()) return false;
+	size_t i{0};
+	for (const Catch & c: expected)
+	{
+		if (found.data()[i].begin != c.begin || found.data()[i].length != c.length) return false;
+		++i;
+	}
+	return true;
+}
+
+// cycle with max stops there (even when inner part would match again)
+bool maximum()
+{
+	RegularExpression<Begin, Repeat<1, 2, DynamicCatch<1, Str<'a','b'>>>, Chr<'a'>> regexp;
+	if (!regexp.match(std::string{"ababab"}) || regexp.length() != 5) return false;
+	return catches<1>(regexp, {{0, 2}, {2, 2}});
+}
+
+// only cycles used by match have catches
+bool usedCycles()
+{
+	RegularExpression<Repeat<1, 4, DynamicCatch<1, Str<'a','b'>>>, Chr<'a'>> regexp;
+	if (!regexp.match(std::string{"abababx"}) || regexp.length() != 5) return false;
+	if (!catches<1>(regexp, {{0, 2}, {2, 2}})) return false;
+	// catches from failed tries at previous positions aren't kept
+	if (!regexp.match(std::string{"abxabx ababa"}) || regexp.position() != 7) return false;
+	return catches<1>(regexp, {{7, 2}, {9, 2}});
+}
+
+// possessive cycle which failed gives its catches back (first option with catch 1 is reported)
+bool possessive()
+{
+	RegularExpression<Id<1,1>, Sel<Seq<PossessiveRepeat<1, 3, DynamicCatch<1, Chr<'a'>>>, Chr<'x'>>, Seq<Repeat<0, 3, DynamicCatch<1, Chr<'a'>>>, Chr<'b'>>>> regexp;
+	if (!regexp.match(std::string{"aab"})) return false;
+	return catches<1>(regexp, {});
+}
+
+int main ()
+{
+	if (!maximum()) return 1;
+	if (!usedCycles()) return 1;
+	if (!possessive()) return 1;
+	return 0;
+}
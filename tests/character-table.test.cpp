@@ -0,0 +1,54 @@
+#include "regexp/regexp.hpp"
+#include <cstdio>
+
+using namespace SRX;
+
+// class looked up in table must accept same bytes as comparing with every code and bound
+template <CompareFnc<char> compare, typename Class> bool sameAsCompare(bool (*reference)(char))
+{
+	RegularExpression<Begin, Class, End> regexp;
+	for (unsigned int c{1}; c != 256; ++c)
+	{
+		const char input[2] = {static_cast<char>(c), '\0'};
+		if (regexp.template operator()<compare>(input) != reference(input[0]) || regexp.template operator()<compare>(input, input + 1) != reference(input[0]))
+		{
+			fprintf(stderr,"different result for byte %u\n",c);
+			return false;
+		}
+	}
+	return true;
+}
+
+bool email(char c)
+{
+	return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '.' || c == '_' || c == '%' || c == '+' || c == '-';
+}
+
+bool notDigit(char c)
+{
+	return c < '0' || c > '9';
+}
+
+bool vowel(char c)
+{
+	return c == 'a' || c == 'e' || c == 'A' || c == 'E';
+}
+
+bool any(char)
+{
+	return true;
+}
+
+int main ()
+{
+	if (!sameAsCompare<charactersAreEqual<char>, Selection<CRange<'A','Z','a','z','0','9'>, CharacterClass<true,'.','_','%','+','-'>>>(email)) return 1;
+	if (!sameAsCompare<charactersAreEqual<char>, CharacterRange<false,'0','9'>>(notDigit)) return 1;
+	// case is folded when table is built
+	if (!sameAsCompare<caseInsensitive, CharacterClass<true,'a','E'>>(vowel)) return 1;
+	if (!sameAsCompare<caseInsensitive, CharacterClass<true>>(any)) return 1;
+	// NUL is end of NUL-terminated input, but it's character in bounded input
+	const char nul[1] = {'\0'};
+	RegularExpression<Begin, CharacterRange<false,'a','z'>> regexp;
+	if (regexp(nul) || !regexp(nul, 1)) return 1;
+	return 0;
+}
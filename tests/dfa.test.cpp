@@ -0,0 +1,61 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+// identifier makes regexp non-deterministic, so it's matched with backtracking
+template <typename... Definition> bool sameResults(const char * alphabet, unsigned int count)
+{
+	static_assert(RegularExpression<Definition...>::deterministic, "regexp must be matched with DFA");
+	RegularExpression<Definition...> dfa;
+	RegularExpression<Id<1,1>, Definition...> backtracking;
+	return forRandomInputs(alphabet, 12, count, [&](const std::string & input)
+	{
+		// span is found with backtracking also by deterministic regexp
+		return dfa(input) == backtracking(input) && dfa(input.c_str()) == backtracking(input.c_str()) && dfa.match(input) == dfa(input);
+	});
+}
+
+bool differential()
+{
+	if (!sameResults<Begin, Plus<CRange<'a','z'>>, Chr<'0'>, End>("ab0", 2000)) return false;
+	if (!sameResults<Selection<Str<'A','B','C'>, Str<'B','C','D'>, Repeat<3,0,Chr<'A'>>>>("ABCD", 2000)) return false;
+	if (!sameResults<Chr<'a'>, Repeat<2,3,Chr<'b'>>, Chr<'c'>>("abc", 2000)) return false;
+	if (!sameResults<Star<Any>, Str<'x','y'>, End>("xyz", 2000)) return false;
+	if (!sameResults<Begin, Opt<Chr<'-'>>, Plus<Number>, Opt<Chr<'.'>, Plus<Number>>, End>("-.12", 2000)) return false;
+	if (!sameResults<NegSet<'a'>, Chr<'a'>, Begin>("ab", 500)) return false;
+	if (!sameResults<End>("ab", 100)) return false;
+	// cycle must use other way of its inner part (last or earlier cycle)
+	if (!sameResults<Begin, Plus<Chr<'c'>, Opt<Chr<'b'>>>, Chr<'b'>>("cb", 2000)) return false;
+	if (!sameResults<Plus<Sel<Str<'a','b'>, Chr<'a'>>>, Chr<'b'>, End>("ab", 2000)) return false;
+	if (!sameResults<Star<Sel<Chr<'a'>, Str<'a','b'>>>, Chr<'c'>, End>("abc", 2000)) return false;
+	if (!sameResults<Begin, Plus<Chr<'x'>, Star<Chr<'a'>>>, Str<'a','b'>>("xab", 2000)) return false;
+	return true;
+}
+
+bool caseInsensitivity()
+{
+	RegularExpression<Begin, Str<'a','b','c'>, End> regexp;
+	if (!regexp.match<caseInsensitive>("ABC")) return false;
+	if (regexp.match<caseSensitive>("ABC")) return false;
+	return true;
+}
+
+bool linearTime()
+{
+	// backtracking needs cubic time for every starting position
+	RegularExpression<Star<Any>, Star<Any>, Star<Any>, Chr<'b'>> regexp;
+	std::string input(20000, 'a');
+	if (regexp(input)) return false;
+	input.push_back('b');
+	if (!regexp(input)) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!caseInsensitivity()) return 1;
+	if (!linearTime()) return 1;
+	return 0;
+}
@@ -0,0 +1,92 @@
+#include "regexp/pattern.hpp"
+#include "tests/random.hpp"
+#include <regex>
+#include <vector>
+
+using namespace SRX;
+
+using Span = std::pair<size_t, size_t>;
+
+template <typename Regexp> std::vector<Span> spans(const Regexp & regexp, const std::string & input)
+{
+	std::vector<Span> result;
+	for (const auto & match: regexp.findAll(input)) result.emplace_back(match.position(), match.length());
+	return result;
+}
+
+// matches must be same as with std::regex_iterator (for regexps where greedy cycles behave same)
+template <typename... Definition> bool sameAsStd(const char * pattern, const char * alphabet, unsigned int count)
+{
+	const RegularExpression<Definition...> regexp;
+	const std::regex reference{pattern};
+	return forRandomInputs(alphabet, 16, count, [&](const std::string & input)
+	{
+		std::vector<Span> expected;
+		for (std::sregex_iterator it{input.begin(), input.end(), reference}, end; it != end; ++it) expected.emplace_back(it->position(), it->length());
+		return spans(regexp, input) == expected;
+	});
+}
+
+bool differential()
+{
+	if (!sameAsStd<Plus<CRange<'a','z'>>>("[a-z]+", "ab1 ", 1000)) return false;
+	if (!sameAsStd<Plus<Number>, Opt<Chr<'.'>, Plus<Number>>>("[0-9]+(\\.[0-9]+)?", "12.a", 1000)) return false;
+	if (!sameAsStd<Selection<Str<'a','b'>, Str<'c','d'>>>("ab|cd", "abcd", 1000)) return false;
+	if (!sameAsStd<Star<Chr<'a'>>>("a*", "ab", 1000)) return false;
+	if (!sameAsStd<Begin, Chr<'a'>>("^a", "ab", 200)) return false;
+	if (!sameAsStd<Chr<'a'>, End>("a$", "ab", 200)) return false;
+	return true;
+}
+
+bool catches()
+{
+	const RegularExpression<DynamicCatch<1, Plus<CRange<'a','z'>>>, Chr<'='>, DynamicCatch<2, Plus<Number>>> regexp;
+	const std::string input{"x=1, abc=23 ,=4 k=v yz=567"};
+	std::vector<std::pair<std::string, std::string>> pairs;
+	for (const auto & match: regexp.findAll(input))
+	{
+		// catch positions are from begin of whole input
+		if (match.whole(input) != match.part<1>(input) + "=" + match.part<2>(input)) return false;
+		pairs.emplace_back(match.part<1>(input), match.part<2>(input));
+	}
+	const std::vector<std::pair<std::string, std::string>> expected{{"x","1"},{"abc","23"},{"yz","567"}};
+	return pairs == expected;
+}
+
+bool nestedCatches()
+{
+	// catches inside of catch are reset before every match too
+	const SRX_REGEXP("((x)*)y") regexp;
+	for (const auto & match: regexp.findAll("xyxyxy"))
+	{
+		if (match.getCatch<1>().size() != 1 || match.getCatch<2>().size() != 1) return false;
+	}
+	return true;
+}
+
+bool iterator()
+{
+	const RegularExpression<Plus<Number>> regexp;
+	const char * input{"a1b22c333"};
+	auto range = regexp.findAll(input);
+	auto it = range.begin();
+	if (it == range.end() || it->position() != 1 || it->length() != 1) return false;
+	++it;
+	if (it == range.end() || it->position() != 3 || (*it).length() != 2) return false;
+	++it;
+	if (it == range.end() || it->position() != 6 || it->length() != 3) return false;
+	++it;
+	if (it != range.end()) return false;
+	// without any match
+	if (regexp.findAll("abc").begin() != regexp.findAll("abc").end()) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!catches()) return 1;
+	if (!nestedCatches()) return 1;
+	if (!iterator()) return 1;
+	return 0;
+}
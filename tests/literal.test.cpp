@@ -0,0 +1,46 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+static_assert(std::is_same<LiteralPrefix<Sequence<Str<'a','b'>, Chr<'c'>, Plus<Chr<'d'>>>>::Type, CodeList<'a','b','c','d'>>::value, "literals are joined, cycle gives its first iteration");
+static_assert(std::is_same<LiteralPrefix<Sequence<Id<1,1>, OneCatch<1, Str<'a','b','c'>>, Chr<'d'>>>::Type, CodeList<'a','b','c','d'>>::value, "identifier and catch are transparent");
+static_assert(std::is_same<LiteralPrefix<Sequence<Star<Chr<'a'>>, Str<'b','c','d'>>>::Type, CodeList<>>::value, "optional part isn't prefix");
+
+// regexp beginning with literal (searched as whole) must match same as regexp beginning with sets
+template <CompareFnc<char> compare, typename Literal, typename Sets> bool sameAsSets(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Literal> literal;
+	RegularExpression<Sets> sets;
+	RegularExpression<Id<1,1>, Literal> backtracking;
+	return forRandomInputs(alphabet, 100, count, [&](const std::string & input)
+	{
+		const bool expected{sets.template match<compare>(input)};
+		if (literal.template operator()<compare>(input) != expected || backtracking.template match<compare>(input) != expected) return false;
+		return !expected || (backtracking.position() == sets.position() && literal.template match<compare>(input) && literal.position() == sets.position());
+	});
+}
+
+bool differential()
+{
+	if (!sameAsSets<charactersAreEqual<char>, Seq<Str<'a','b','c'>, Star<Any>, Chr<'d'>>, Seq<Set<'a'>, Set<'b'>, Set<'c'>, Star<Any>, Chr<'d'>>>("abcd", 2000)) return false;
+	if (!sameAsSets<charactersAreEqual<char>, Seq<Str<'a','a','b','a'>>, Seq<Set<'a'>, Set<'a'>, Set<'b'>, Set<'a'>>>("ab", 2000)) return false;
+	if (!sameAsSets<caseInsensitive, Seq<Str<'a','B','c'>>, Seq<Set<'a'>, Set<'B'>, Set<'c'>>>("aAbBcC", 2000)) return false;
+	return true;
+}
+
+bool stream()
+{
+	// literal is split between pieces
+	RegularExpression<Str<'A','B','C','D'>>::Stream<> matcher;
+	matcher.feed(std::string(40, 'x') + "AB");
+	matcher.feed("CDxx");
+	return matcher.finish();
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!stream()) return 1;
+	return 0;
+}
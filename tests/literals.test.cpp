@@ -0,0 +1,58 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+using Keywords = Sel<Str<'a','b'>, Str<'a'>, Str<'b','c','a'>, Str<'a','b','c','a'>, Str<'c'>, Str<'a','b'>, Str<'c','c','c'>>;
+
+// narrow strings use automaton for literals, wide strings try every option
+template <typename... Definition> bool sameResults(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Definition...> narrow;
+	RegularExpression<Definition...> wide;
+	return forRandomInputs(alphabet, 12, count, [&](const std::string & input)
+	{
+		const std::wstring winput(input.begin(), input.end());
+		narrow.reset();
+		wide.reset();
+		const bool matched{narrow(input)};
+		if (matched != wide(winput)) return false;
+		return !matched || sameCatches(narrow.template getCatch<1>(), wide.template getCatch<1>());
+	});
+}
+
+bool differential()
+{
+	if (!sameResults<OneCatch<1, Keywords>, End>("abc", 3000)) return false;
+	if (!sameResults<Begin, DynamicCatch<1, Keywords>, Str<'b','c'>>("abc", 3000)) return false;
+	if (!sameResults<Begin, Plus<DynamicCatch<1, Keywords>>, End>("abc", 3000)) return false;
+	if (!sameResults<OneCatch<1, Sel<Str<'x'>, Str<'y','y'>, Empty, Str<'z'>>>, Chr<'y'>>("xyz", 3000)) return false;
+	return true;
+}
+
+bool caseInsensitivity()
+{
+	RegularExpression<Begin, OneCatch<1, Sel<Str<'g','e','t'>, Str<'p','u','t'>, Str<'p','o','s','t'>, Str<'h','e','a','d'>>>, Chr<' '>> regexp;
+	const std::string input{"POST /"};
+	if (regexp(input)) return false;
+	if (!regexp.match<caseInsensitive>(input)) return false;
+	if (regexp.part<1>(input) != "POST") return false;
+	return true;
+}
+
+bool boundedInput()
+{
+	const char buffer[] = {'c','c','c','c'};
+	RegularExpression<Begin, OneCatch<1, Keywords>, End> regexp;
+	if (regexp(buffer, 2)) return false;
+	if (!regexp(buffer, 3)) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!caseInsensitivity()) return 1;
+	if (!boundedInput()) return 1;
+	return 0;
+}
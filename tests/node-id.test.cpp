@@ -0,0 +1,30 @@
+#include "regexp/regexp.hpp"
+
+using namespace SRX;
+
+using Pattern = Eat<Begin, OneCatch<1, Plus<CRange<'a','z'>>>, Sel<Str<'a','b'>, Plus<Chr<'x'>, Chr<'y'>>>, End>;
+
+template <unsigned int position, typename Node> constexpr bool at()
+{
+	return std::is_same<typename NodeAt<Pattern, position>::Type, Node>::value;
+}
+
+// Eat, Begin, catch, cycle, range, selection, string, cycle, sequence, two characters, End
+static_assert(NodeCount<Pattern>::value == 12, "every node is counted");
+static_assert(at<0, Pattern>(), "root is first");
+static_assert(at<1, Begin>(), "preorder");
+static_assert(at<2, OneCatch<1, Plus<CRange<'a','z'>>>>(), "catch");
+static_assert(at<3, Plus<CRange<'a','z'>>>(), "node inside catch");
+static_assert(at<5, Sel<Str<'a','b'>, Plus<Chr<'x'>, Chr<'y'>>>>(), "selection after whole catch");
+static_assert(at<7, Plus<Chr<'x'>, Chr<'y'>>>(), "cycle over more parts");
+static_assert(at<8, Seq<Chr<'x'>, Chr<'y'>>>(), "is cycle over sequence");
+static_assert(at<11, End>(), "last node");
+
+// equal nodes have own positions
+using Twice = Eat<Star<Any>, Chr<'x'>, Star<Any>>;
+static_assert(std::is_same<NodeAt<Twice, 1>::Type, NodeAt<Twice, 4>::Type>::value && NodeCount<Twice>::value == 6, "both cycles are counted");
+
+int main ()
+{
+	return 0;
+}
@@ -0,0 +1,54 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+using First = Seq<Begin, Plus<CRange<'a','z'>>, Chr<'='>>;
+using Second = Str<'a','b','c'>;
+using Third = Seq<Repeat<2,3,Chr<'b'>>, End>;
+using Fourth = Seq<Chr<'c'>, Star<Any>, Chr<'a'>>;
+
+template <typename Pattern> bool single(const std::string & input)
+{
+	// identifier makes regexp non-deterministic (it's matched separately)
+	RegularExpression<Id<1,1>, Pattern> regexp;
+	return regexp(input);
+}
+
+bool differential()
+{
+	const PatternSet<First, Second, Third, Fourth> patterns;
+	static_assert(PatternSet<First, Second, Third, Fourth>::deterministic, "patterns must be matched with one DFA");
+	return forRandomInputs("abc=", 12, 3000, [&](const std::string & input)
+	{
+		const uint64_t expected{(single<First>(input) ? 1u : 0u) | (single<Second>(input) ? 2u : 0u) | (single<Third>(input) ? 4u : 0u) | (single<Fourth>(input) ? 8u : 0u)};
+		return patterns(input) == expected && patterns(input.c_str()) == expected;
+	});
+}
+
+bool nonDeterministic()
+{
+	// pattern with catch is matched separately, but results are same
+	PatternSet<Second, OneCatch<1, Plus<Chr<'x'>>>, Third> patterns;
+	if (patterns("abcxbb") != 7) return false;
+	if (patterns("xyz") != 2) return false;
+	if (patterns(L"abcbbb") != 5) return false;
+	if (patterns("") != 0) return false;
+	return true;
+}
+
+bool caseInsensitivity()
+{
+	PatternSet<Second, Str<'x','y'>> patterns;
+	if (patterns.match<caseInsensitive>("ABC XY") != 3) return false;
+	if (patterns.match<caseSensitive>("ABC XY") != 0) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!nonDeterministic()) return 1;
+	if (!caseInsensitivity()) return 1;
+	return 0;
+}
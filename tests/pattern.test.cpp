@@ -0,0 +1,87 @@
+#include "regexp/pattern.hpp"
+#include "tests/random.hpp"
+#include <regex>
+
+using namespace SRX;
+
+static_assert(std::is_same<SRX_REGEXP("^ab+[a-c]$"), RegularExpression<Sequence<Begin, String<'a'>, Repeat<1, 0, String<'b'>>, CharacterRange<true, 'a', 'c'>, End>>>::value, "literals are joined into String");
+static_assert(std::is_same<SRX_REGEXP("(a)(b)*"), RegularExpression<Sequence<OneCatch<1, Sequence<String<'a'>>>, Repeat<0, 0, DynamicCatch<2, Sequence<String<'b'>>>>>>>::value, "only catch in cycle has dynamic memory");
+
+static_assert(std::is_same<SRX_REGEXP("[]a][^]-]"), RegularExpression<Sequence<CharacterRange<true, ']', ']', 'a', 'a'>, CharacterRange<false, ']', ']', '-', '-'>>>>::value, "] right after [ is literal");
+static_assert(std::is_same<SRX_REGEXP("(a)\\1"), RegularExpression<Sequence<OneCatch<1, Sequence<String<'a'>>>, ReCatch<1, lastCatch>>>>::value, "\\N is back-reference to last content of N-th catch");
+static_assert(std::is_same<SRX_REGEXP("a|"), RegularExpression<Selection<Sequence<String<'a'>>, Empty>>>::value, "empty option matches empty string");
+static_assert(std::is_same<SRX_REGEXP("a{0}b"), RegularExpression<Sequence<Empty, String<'b'>>>>::value, "atom repeated zero times matches empty string");
+
+// parsed regexp must find match in same inputs as std::regex
+template <typename Regexp> bool sameAsStd(const char * pattern, const char * alphabet, unsigned int count)
+{
+	const Regexp regexp{};
+	const std::regex reference{pattern};
+	typename Regexp::Results results;
+	return forRandomInputs(alphabet, 12, count, [&](const std::string & input)
+	{
+		return regexp.match(input, results) == std::regex_search(input, reference);
+	});
+}
+
+bool differential()
+{
+	if (!sameAsStd<SRX_REGEXP("^[a-z]+=\\d+$")>("^[a-z]+=\\d+$", "ab=1", 2000)) return false;
+	if (!sameAsStd<SRX_REGEXP("ab|cd|e")>("ab|cd|e", "abcde", 2000)) return false;
+	if (!sameAsStd<SRX_REGEXP("a{2,3}b")>("a{2,3}b", "ab", 2000)) return false;
+	if (!sameAsStd<SRX_REGEXP("x(?:ab)+y")>("x(?:ab)+y", "xaby", 2000)) return false;
+	if (!sameAsStd<SRX_REGEXP("[^a-c]\\.[-x]")>("[^a-c]\\.[-x]", "ad.-x", 2000)) return false;
+	if (!sameAsStd<SRX_REGEXP("\\s\\w\\S")>("\\s\\w\\S", " a_1", 2000)) return false;
+	if (!sameAsStd<SRX_REGEXP("([ab]+)c\\1")>("([ab]+)c\\1", "abc", 2000)) return false;
+	// empty options, groups and {0}
+	if (!sameAsStd<SRX_REGEXP("a|")>("a|", "ab", 200)) return false;
+	if (!sameAsStd<SRX_REGEXP("(|a)b")>("(|a)b", "ab", 1000)) return false;
+	if (!sameAsStd<SRX_REGEXP("a()b")>("a()b", "ab", 1000)) return false;
+	if (!sameAsStd<SRX_REGEXP("a(?:)b")>("a(?:)b", "ab", 1000)) return false;
+	if (!sameAsStd<SRX_REGEXP("a{0}b")>("a{0}b", "ab", 1000)) return false;
+	if (!sameAsStd<SRX_REGEXP("ab{0}")>("ab{0}", "ab", 1000)) return false;
+	return true;
+}
+
+// back-reference matches same characters in same order, also when it's in cycle with its catch
+bool backReferences()
+{
+	using Twice = SRX_REGEXP("^([a-z]+)-\\1$");
+	const Twice twice{};
+	Twice::Results results;
+	if (!twice.match("abc-abc", results) || results.part<1>(std::string{"abc-abc"}) != "abc") return false;
+	if (twice.match("abc-cba", results) || twice.match("abc-ab", results) || twice.match("ab-abc", results)) return false;
+	using Pairs = SRX_REGEXP("^(?:([a-z])\\1)+$");
+	const Pairs pairs{};
+	Pairs::Results pairsResults;
+	if (!pairs.match("aabbcc", pairsResults) || pairs.match("aabc", pairsResults)) return false;
+	using Second = SRX_REGEXP("(a+)(b+)\\2\\1");
+	const Second second{};
+	Second::Results secondResults;
+	return second.match("xaabbbbaay", secondResults) && secondResults.length() == 8 && !second.match("aabbbaa", secondResults);
+}
+
+bool catches()
+{
+	using Url = SRX_REGEXP("^([a-z]+)://([a-z]+)(\\.[a-z]+)*/(.*)$");
+	const Url regexp{};
+	Url::Results results;
+	const std::string input{"http://www.example.com/index.html"};
+	if (!regexp.match(input, results)) return false;
+	if (results.part<1>(input) != "http") return false;
+	if (results.part<2>(input) != "www") return false;
+	if (results.getCatch<3>().size() != 2) return false;
+	if (results.part<3>(input, 0) != ".example" || results.part<3>(input, 1) != ".com") return false;
+	if (results.part<4>(input) != "index.html") return false;
+	if (regexp.match("http://www/", results) != true) return false;
+	if (regexp.match("http:/www/", results) != false) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!backReferences()) return 1;
+	if (!catches()) return 1;
+	return 0;
+}
@@ -0,0 +1,75 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+bool possessive()
+{
+	RegularExpression<Begin, PossessivePlus<Chr<'a'>>, Chr<'a'>> never;
+	if (never("aaa")) return false;
+	RegularExpression<Begin, Plus<Chr<'a'>>, Chr<'a'>> greedy;
+	if (!greedy("aaa")) return false;
+	RegularExpression<Begin, PossessiveRepeat<2,3,Chr<'a'>>, Chr<'a','b'>, End> limited;
+	if (!limited(std::string{"aaaa"}) || !limited(std::string{"aab"}) || limited(std::string{"aaaaa"}) || limited(std::string{"ab"})) return false;
+	RegularExpression<Begin, PossessiveStar<Str<'a','b'>>, End> empty;
+	if (!empty("") || !empty("abab") || empty("aba")) return false;
+	return true;
+}
+
+bool atomic()
+{
+	RegularExpression<Begin, Atomic<Sel<Str<'a','b'>, Chr<'a'>>>, Str<'b','c'>> regexp;
+	if (regexp("abc")) return false;
+	if (!regexp("abbc")) return false;
+	RegularExpression<Begin, Sel<Str<'a','b'>, Chr<'a'>>, Str<'b','c'>> backtracking;
+	if (!backtracking("abc")) return false;
+	return true;
+}
+
+bool catches()
+{
+	RegularExpression<Begin, PossessivePlus<DynamicCatch<1, Plus<CRange<'a','z'>>>, Chr<' '>>, OneCatch<2, Atomic<Plus<Number>>>, End> regexp;
+	const std::string input{"get put head 123"};
+	if (!regexp(input)) return false;
+	if (regexp.getCatch<1>().size() != 3 || regexp.part<1>(input, 2) != "head") return false;
+	if (regexp.part<2>(input) != "123") return false;
+	// catch inside of atomic group isn't kept when its continuation fails: ^(?:(?>(a))b|ac)
+	RegularExpression<Begin, Sel<Seq<Atomic<OneCatch<1, Chr<'a'>>>, Chr<'b'>>, Str<'a','c'>>> rollback;
+	if (!rollback("ac") || rollback.getCatch<1>().size() != 0) return false;
+	if (!rollback("ab") || rollback.getCatch<1>().size() != 1) return false;
+	return true;
+}
+
+// cycles followed by disjoint continuation are matched possessively, but only for one-byte characters
+template <typename... Definition> bool samePromoted(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Id<9,1>, Definition...> narrow;
+	RegularExpression<Id<9,1>, Definition...> wide;
+	return forRandomInputs(alphabet, 12, count, [&](const std::string & input)
+	{
+		const std::wstring winput(input.begin(), input.end());
+		narrow.reset();
+		wide.reset();
+		const bool matched{narrow(input)};
+		if (matched != wide(winput)) return false;
+		// catches are defined only for successful match
+		return !matched || (sameCatches(narrow.template getCatch<1>(), wide.template getCatch<1>()) && sameCatches(narrow.template getCatch<2>(), wide.template getCatch<2>()));
+	});
+}
+
+bool promotion()
+{
+	if (!samePromoted<Plus<DynamicCatch<1, Plus<CRange<'a','b'>>>, Chr<' '>>, DynamicCatch<2, Plus<Number>>, End>("ab 1", 3000)) return false;
+	if (!samePromoted<Begin, Repeat<1,2,DynamicCatch<1, Chr<'a'>>>, DynamicCatch<2, Star<Chr<'b'>>>, End>("ab", 3000)) return false;
+	if (!samePromoted<DynamicCatch<1, Star<Chr<'a'>>>, Chr<'b'>, DynamicCatch<2, Plus<Chr<'a','c'>>>>("abc", 3000)) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!possessive()) return 1;
+	if (!atomic()) return 1;
+	if (!catches()) return 1;
+	if (!promotion()) return 1;
+	return 0;
+}
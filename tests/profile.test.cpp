@@ -0,0 +1,57 @@
+#define SRX_PROFILE
+#include "regexp/regexp.hpp"
+#include <sstream>
+
+using namespace SRX;
+
+const NodeProfile * find(const Profile & profile, const std::string & name)
+{
+	for (const NodeProfile & node: profile.nodes)
+	{
+		if (node.name == name) return &node;
+	}
+	return nullptr;
+}
+
+bool counters()
+{
+	RegularExpression<OneCatch<1, Plus<CRange<'a','z'>>>, Sel<Chr<'1'>, Chr<'2'>>> regexp;
+	if (!regexp(std::string("ab2")) || regexp(std::string("--"))) return false;
+	const NodeProfile * eat{find(regexp.profile(), "Eat")};
+	const NodeProfile * selection{find(regexp.profile(), "Selection<2>")};
+	const NodeProfile * catchContent{find(regexp.profile(), "CatchContent<1>")};
+	if (!eat || eat->entries != 2 || eat->successes != 1 || eat->bytes != 3) return false;
+	// first option failed once
+	if (!selection || selection->entries != 1 || selection->successes != 1 || selection->backtracks != 1 || selection->bytes != 1) return false;
+	if (!catchContent || catchContent->successes != 1 || catchContent->bytes != 3) return false;
+	return true;
+}
+
+bool blowup()
+{
+	// cycle which gives back most often is visible
+	RegularExpression<Id<1,1>, Star<Any>, Chr<'x'>, Star<Any>, Chr<'y'>> regexp;
+	if (regexp(std::string(50, 'x'))) return false;
+	unsigned long long most{0};
+	std::string name;
+	for (const NodeProfile & node: regexp.profile().nodes)
+	{
+		if (node.backtracks > most)
+		{
+			most = node.backtracks;
+			name = node.name;
+		}
+	}
+	if (name != "Repeat<0,0>" || most < 50) return false;
+	std::ostringstream json;
+	regexp.profile().toJSON(json);
+	// second Star<Any> has own counters
+	return json.str().find("{\"id\":2,\"node\":\"Repeat<0,0>\",\"entries\":") != std::string::npos && json.str().find("{\"id\":5,\"node\":\"Repeat<0,0>\",\"entries\":") != std::string::npos;
+}
+
+int main ()
+{
+	if (!counters()) return 1;
+	if (!blowup()) return 1;
+	return 0;
+}
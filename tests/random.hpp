@@ -0,0 +1,35 @@
+#ifndef __TESTS__RANDOM__HPP__
+#define __TESTS__RANDOM__HPP__
+
+#include "regexp/regexp.hpp"
+#include "src/random.hpp"
+#include <cstdio>
+
+// check must hold for count random inputs, first input where it doesn't is reported
+template <typename Check> bool forRandomInputs(const char * alphabet, unsigned int limit, unsigned int count, Check && check)
+{
+	Random random{count};
+	for (unsigned int i{0}; i != count; ++i)
+	{
+		const std::string input{random.input(alphabet, limit)};
+		if (!check(input))
+		{
+			fprintf(stderr,"different result for input '%s'\n",input.c_str());
+			return false;
+		}
+	}
+	return true;
+}
+
+// all contents of catch are same
+inline bool sameCatches(const SRX::CatchReturn & a, const SRX::CatchReturn & b)
+{
+	if (a.size() != b.size()) return false;
+	for (size_t i{0}; i != a.size(); ++i)
+	{
+		if (a.data()[i].begin != b.data()[i].begin || a.data()[i].length != b.data()[i].length) return false;
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,58 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+#include <vector>
+
+using namespace SRX;
+
+static_assert(std::is_same<RequiredLiteral<Sequence<Plus<CRange<'a','z'>>, Str<':','/','/'>, Plus<CRange<'a','z'>>>>::Type, CodeList<':','/','/'>>::value, "literal in middle");
+static_assert(std::is_same<RequiredLiteral<Sequence<Star<Any>, Chr<'a'>, OneCatch<1, Str<'b','c'>>, Plus<Chr<'d'>>, Chr<'e'>>>::Type, CodeList<'a','b','c','d'>>::value, "complete parts are joined with prefix of next part");
+static_assert(std::is_same<RequiredLiteral<Sequence<Str<'a','b'>, Star<Any>, Plus<Seq<Chr<'x'>, Str<'y','z','w'>>>>>::Type, CodeList<'x','y','z','w'>>::value, "longest literal is used");
+static_assert(std::is_same<RequiredLiteral<Sequence<Selection<Str<'a','b','c'>, Str<'d','e','f'>>>>::Type, CodeList<>>::value, "option isn't required");
+static_assert(std::is_same<RequiredLiteral<Sequence<Chr<'a'>, End, Str<'b','c','d'>>>::Type, CodeList<'b','c','d'>>::value, "rest after End is matched too");
+
+// regexp with required literal (prefiltered) must match same as regexp where literal is written as sets
+template <typename Literal, typename Sets> bool sameAsSets(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Literal> dfa;
+	RegularExpression<Id<1,1>, Literal> backtracking;
+	RegularExpression<Sets> sets;
+	return forRandomInputs(alphabet, 60, count, [&](const std::string & input)
+	{
+		const bool expected{sets.match(input)};
+		if (dfa(input) != expected || dfa(input.c_str()) != expected || backtracking.match(input) != expected || backtracking(input.c_str()) != expected) return false;
+		size_t found{0}, reference{0};
+		for (const auto & match: dfa.findAll(input)) found += match.position();
+		for (const auto & match: sets.findAll(input)) reference += match.position();
+		return found == reference;
+	});
+}
+
+bool differential()
+{
+	if (!sameAsSets<Seq<Plus<CRange<'a','b'>>, Str<':','/','/'>, Plus<CRange<'a','b'>>>, Seq<Plus<CRange<'a','b'>>, Set<':'>, Set<'/'>, Set<'/'>, Plus<CRange<'a','b'>>>>("ab:/", 3000)) return false;
+	if (!sameAsSets<Seq<Star<Any>, Str<'a','b','a'>>, Seq<Star<Any>, Set<'a'>, Set<'b'>, Set<'a'>>>("ab", 2000)) return false;
+	if (!sameAsSets<Seq<Opt<Chr<'x'>>, Str<'a','b'>, Plus<Chr<'c'>>>, Seq<Opt<Chr<'x'>>, Set<'a'>, Set<'b'>, Plus<Chr<'c'>>>>("xabc", 2000)) return false;
+	return true;
+}
+
+bool rejected()
+{
+	// only text around literal must be scanned by engine, input without it is rejected before
+	RegularExpression<Plus<CRange<'a','z'>>, Str<':','/','/'>, Plus<CRange<'a','z'>>> regexp;
+	if (regexp("http:/x") || regexp(std::string{"http:/x"})) return false;
+	if (!regexp.match(std::string{"http://x"}) || regexp.position() != 0 || regexp.length() != 8) return false;
+	// literal is found, but next part is missing
+	if (regexp("x x http://") || regexp(std::string{"x x http://"})) return false;
+	RegularExpression<Star<Any>, Str<'a','b','c'>> letters;
+	if (!letters.match<caseInsensitive>("xABC") || letters.match("xABC")) return false;
+	std::vector<size_t> positions;
+	for (const auto & match: regexp.findAll("a://b c:/d e://f")) positions.push_back(match.position());
+	return positions == std::vector<size_t>{0, 11};
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!rejected()) return 2;
+	return 0;
+}
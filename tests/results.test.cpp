@@ -0,0 +1,79 @@
+#include "regexp/pattern.hpp"
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace SRX;
+
+using KeyValue = RegularExpression<Begin, DynamicCatch<1, Plus<CRange<'a','z'>>>, Chr<'='>, Sel<Seq<Id<1,1>, DynamicCatch<2, Plus<Number>>>, Seq<Id<1,2>, DynamicCatch<3, Plus<CRange<'a','z'>>>>>, End>;
+
+const KeyValue regexp;
+
+bool check(const std::string & input, const std::string & key, const std::string & value, unsigned int type)
+{
+	KeyValue::Results results;
+	if (!regexp.match(input, results)) return false;
+	if (results.getIdentifier<1>() != type) return false;
+	if (results.getCatch<1>().size() != 1 || results.getCatch<2>().size() != (type == 1) || results.getCatch<3>().size() != (type == 2)) return false;
+	if (results.part<1>(input) != key) return false;
+	if ((type == 1 ? results.part<2>(input) : results.part<3>(input)) != value) return false;
+	return true;
+}
+
+bool singleThread()
+{
+	if (!check("abc=123", "abc", "123", 1)) return false;
+	// results are reset before every match
+	if (!check("x=y", "x", "y", 2)) return false;
+	KeyValue::Results results;
+	if (regexp.match("abc=", results)) return false;
+	if (results.getCatch<1>().size() != 0) return false;
+	return true;
+}
+
+bool nestedCatches()
+{
+	// catch inside of catch is reset too, when results (or regexp itself) are used again
+	const SRX_REGEXP("^.((x)*)?") optional;
+	SRX_REGEXP("^.((x)*)?")::Results results;
+	for (unsigned int i{0}; i != 3; ++i)
+	{
+		if (!optional.match(".x", results)) return false;
+		if (results.getCatch<1>().size() != 1 || results.getCatch<2>().size() != 1) return false;
+	}
+	SRX_REGEXP("((x)*)y") mutableRegexp;
+	for (unsigned int i{0}; i != 3; ++i)
+	{
+		if (!mutableRegexp("xy")) return false;
+		if (mutableRegexp.getCatch<1>().size() != 1 || mutableRegexp.getCatch<2>().size() != 1) return false;
+	}
+	return true;
+}
+
+bool moreThreads()
+{
+	std::vector<std::thread> threads;
+	std::vector<int> ok(4, 1);
+	for (unsigned int t{0}; t != ok.size(); ++t)
+	{
+		threads.emplace_back([t, &ok]{
+			for (unsigned int i{0}; i != 1000; ++i)
+			{
+				const std::string key(1 + (i + t) % 7, static_cast<char>('a' + t));
+				const std::string value{std::to_string(i)};
+				if (!check(key + "=" + value, key, value, 1)) ok[t] = 0;
+			}
+		});
+	}
+	for (auto & thread: threads) thread.join();
+	for (int result: ok) if (!result) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!singleThread()) return 1;
+	if (!nestedCatches()) return 1;
+	if (!moreThreads()) return 1;
+	return 0;
+}
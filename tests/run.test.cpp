@@ -0,0 +1,52 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+// cycle over one character (whole run is scanned at once) must match same as cycle over sequence with that character
+template <typename Fast, typename Slow> bool sameAsSequence(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Fast> fast;
+	RegularExpression<Slow> slow;
+	// longer than one vector
+	return forRandomInputs(alphabet, 80, count, [&](const std::string & input)
+	{
+		const bool expected{slow.match(input)};
+		if (fast.match(input) != expected || fast(input.c_str()) != slow(input.c_str())) return false;
+		if (expected && (fast.position() != slow.position() || fast.length() != slow.length())) return false;
+		return sameCatches(fast.template getCatch<1>(), slow.template getCatch<1>());
+	});
+}
+
+bool differential()
+{
+	if (!sameAsSequence<Seq<Id<1,1>, Plus<CRange<'a','z'>>, Chr<'0'>>, Seq<Id<1,1>, Plus<Seq<CRange<'a','z'>>>, Chr<'0'>>>("ab0", 2000)) return false;
+	if (!sameAsSequence<Seq<Id<1,1>, Star<Any>, Str<'x','y'>>, Seq<Id<1,1>, Star<Seq<Any>>, Str<'x','y'>>>("xyz", 2000)) return false;
+	if (!sameAsSequence<Seq<Begin, OneCatch<1, Star<Any>>, Chr<'b'>>, Seq<Begin, OneCatch<1, Star<Seq<Any>>>, Chr<'b'>>>("ab", 500)) return false;
+	if (!sameAsSequence<Seq<OneCatch<1, Repeat<2,0,NegSet<'a'>>>, Chr<'a'>>, Seq<OneCatch<1, Repeat<2,0,Seq<NegSet<'a'>>>>, Chr<'a'>>>("abc", 2000)) return false;
+	if (!sameAsSequence<Seq<Chr<'<'>, OneCatch<1, Star<CharacterRange<false,'>','>'>>>, Chr<'>'>>, Seq<Chr<'<'>, OneCatch<1, Star<Seq<CharacterRange<false,'>','>'>>>>, Chr<'>'>>>("<a>", 2000)) return false;
+	// possessive cycle
+	if (!sameAsSequence<Seq<Id<1,1>, PossessiveRepeat<1,3,CRange<'a','b'>>, Chr<'b'>>, Seq<Id<1,1>, PossessiveRepeat<1,3,Seq<CRange<'a','b'>>>, Chr<'b'>>>("abc", 2000)) return false;
+	return true;
+}
+
+bool bounded()
+{
+	// NUL is character in bounded input and end of NUL-terminated one
+	const std::string input{"aaaa\0aaaab", 10};
+	RegularExpression<Star<NegSet<'b'>>, Chr<'b'>> regexp;
+	if (!regexp.match(input) || regexp.length() != 10) return false;
+	if (regexp(input.c_str())) return false;
+	// run ends at end of buffer, not at following data
+	const char buffer[] = "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz0";
+	RegularExpression<Begin, Plus<CRange<'a','z'>>, End> letters;
+	if (!letters(buffer, 52) || letters(buffer, 53)) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!bounded()) return 1;
+	return 0;
+}
@@ -0,0 +1,103 @@
+#include "regexp/runtime.hpp"
+#include "regexp/pattern.hpp"
+#include "tests/random.hpp"
+#include <regex>
+
+using namespace SRX;
+
+// runtime regexp must find same match (and last content of every catch) as std::regex
+bool sameAsStd(const char * pattern, const char * alphabet, unsigned int count)
+{
+	RuntimeRegularExpression regexp{pattern};
+	const std::regex reference{pattern};
+	RuntimeRegularExpression::Results results;
+	if (!regexp.valid()) return false;
+	return forRandomInputs(alphabet, 12, count, [&](const std::string & input)
+	{
+		std::smatch expected;
+		const bool matched{std::regex_search(input, expected, reference)};
+		if (regexp(input) != matched || regexp.match(input) != matched || static_cast<const RuntimeRegularExpression &>(regexp).match(input, results) != matched) return false;
+		if (!matched) return true;
+		if (regexp.position() != static_cast<size_t>(expected.position(0)) || results.length() != static_cast<size_t>(expected.length(0))) return false;
+		for (unsigned int id{1}; id < expected.size(); ++id)
+		{
+			CatchReturn found{results.getCatch(id)};
+			if (found.size() == 0 ? expected[id].matched : (found[found.size() - 1].begin != expected.position(id) || found[found.size() - 1].length != expected.length(id))) return false;
+		}
+		return true;
+	});
+}
+
+bool differential()
+{
+	// deterministic (DFA and backtracking for span)
+	if (!sameAsStd("^[a-z]+=\\d+$", "ab=1", 2000)) return false;
+	if (!sameAsStd("ab|cd|e", "abcde", 2000)) return false;
+	if (!sameAsStd("a{2,3}b", "ab", 2000)) return false;
+	if (!sameAsStd("x(ab)+y", "xaby", 2000)) return false;
+	if (!sameAsStd("[^a-c]\\.[-x]", "ad.-x", 2000)) return false;
+	if (!sameAsStd("\\s\\w{2}\\S", " a_1", 2000)) return false;
+	if (!sameAsStd("(a|ab)(c|bcd)(d*)", "abcd", 2000)) return false;
+	if (!sameAsStd("(ab|a)*b", "ab", 2000)) return false;
+	if (!sameAsStd("a$b|b$", "ab", 500)) return false;
+	if (!sameAsStd("(?:a$|b)c", "abc", 500)) return false;
+	// back-references (only backtracking)
+	if (!sameAsStd("(a+)b\\1", "ab", 2000)) return false;
+	if (!sameAsStd("([ab])\\1+", "abc", 2000)) return false;
+	return true;
+}
+
+// catches are same as in regexp parsed at compile time
+bool sameAsPattern()
+{
+	using Url = SRX_REGEXP("^([a-z]+)://([a-z]+)(\\.[a-z]+)*/(.*)$");
+	const Url compiled{};
+	Url::Results expected;
+	const RuntimeRegularExpression regexp{"^([a-z]+)://([a-z]+)(\\.[a-z]+)*/(.*)$"};
+	RuntimeRegularExpression::Results results;
+	const std::string input{"http://www.example.com/index.html"};
+	if (!compiled.match(input, expected) || !regexp.match(input, results)) return false;
+	if (results.part<1>(input) != expected.part<1>(input) || results.part<2>(input) != expected.part<2>(input)) return false;
+	if (results.getCatch<3>().size() != expected.getCatch<3>().size() || results.part<3>(input, 0) != expected.part<3>(input, 0) || results.part<3>(input, 1) != expected.part<3>(input, 1)) return false;
+	if (results.part<4>(input) != "index.html" || results.whole(input) != input) return false;
+	// $ inside of pattern is followed by rest of pattern in both engines
+	SRX_REGEXP("a$b") endThenCharacter{};
+	SRX_REGEXP("(?:a$|b)c") endInOption{};
+	RuntimeRegularExpression runtimeEndThenCharacter{"a$b"};
+	RuntimeRegularExpression runtimeEndInOption{"(?:a$|b)c"};
+	for (const std::string text: {"a", "ab", "ac", "bc", "a\nb"})
+	{
+		if (endThenCharacter.match(text) || runtimeEndThenCharacter.match(text)) return false;
+		if (endInOption.match(text) != runtimeEndInOption.match(text) || endInOption(text) != runtimeEndInOption(text)) return false;
+	}
+	return endInOption(std::string{"bc"}) && !endInOption(std::string{"a"});
+}
+
+bool errors()
+{
+	const char * wrong[] = {"a(b", "a)b", "[ab", "*a", "a{2,1}", "a{1001}", "a*?", "[\\W]", "ab\\", "a\\b", "\\x41", "\\0", "[\\1]"};
+	for (const char * pattern: wrong)
+	{
+		RuntimeRegularExpression regexp{pattern};
+		if (regexp.valid() || !regexp.error() || regexp("ab")) return false;
+	}
+	if (RuntimeRegularExpression{"a(b"}.errorPosition() != 3) return false;
+	// ] right after [ is literal
+	RuntimeRegularExpression bracket{"^[]a]+$"};
+	if (!bracket.valid() || !bracket("]a]") || bracket("b")) return false;
+	// span is known only after match (DFA doesn't find it)
+	RuntimeRegularExpression digits{"\\d+"};
+	if (!digits(std::string{"ab 12"}) || digits.hasSpan() || !digits.match(std::string{"ab 12"}) || !digits.hasSpan() || digits.position() != 3) return false;
+	// possessive cycle doesn't give back
+	RuntimeRegularExpression possessive{"a++a"};
+	if (!possessive.valid() || possessive("aaa")) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!sameAsPattern()) return 1;
+	if (!errors()) return 1;
+	return 0;
+}
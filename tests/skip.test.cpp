@@ -0,0 +1,84 @@
+#include "regexp/regexp.hpp"
+#include <cstdio>
+
+using namespace SRX;
+
+template <typename Regexp> bool check(const char * str, bool expected)
+{
+	Regexp regexp;
+	if (regexp(str) != expected)
+	{
+		fprintf(stderr,"input '%s' should %smatch!\n",str,expected ? "" : "not ");
+		return false;
+	}
+	return true;
+}
+
+bool oneByte()
+{
+	using Regexp = RegularExpression<Str<'A','B','C','D'>>;
+	if (!check<Regexp>("ABCD", true)) return false;
+	if (!check<Regexp>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxABCD", true)) return false;
+	if (!check<Regexp>("xxxxxxxxxxxxxxxxxAxxxxxxxxxxxxxxxxxxxxABCxxxxxxABC", false)) return false;
+	if (!check<Regexp>("", false)) return false;
+	return true;
+}
+
+bool fewBytes()
+{
+	using Regexp = RegularExpression<Selection<Str<'A','B','C','D','E'>,Str<'D','E','F','G','H'>,Str<'E','F','G','H','I'>,Repeat<4,0,Chr<'A'>>>>;
+	if (!check<Regexp>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxAAAA", true)) return false;
+	if (!check<Regexp>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxDEFGHxxxxxxxxxxxxxxxxxxx", true)) return false;
+	if (!check<Regexp>("xxxxxxxxxxxxxxxAAAxxxxxxxxxxxxxDEFGxxxxxxxxxxxxxxxxEFGH", false)) return false;
+	return true;
+}
+
+bool table()
+{
+	using Regexp = RegularExpression<Plus<CRange<'a','z'>>, Chr<'@'>>;
+	if (!check<Regexp>("          0123456789          0123456789          a@", true)) return false;
+	if (!check<Regexp>("          0123456789          0123456789          @a", false)) return false;
+	return true;
+}
+
+bool nullable()
+{
+	using Regexp = RegularExpression<Begin, Star<Chr<'a'>>, End>;
+	if (!check<Regexp>("", true)) return false;
+	if (!check<Regexp>("aaaa", true)) return false;
+	if (!check<Regexp>("aaab", false)) return false;
+	using Optional = RegularExpression<Star<Chr<'a'>>, Chr<'b'>>;
+	if (!check<Optional>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxb", true)) return false;
+	if (!check<Optional>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxa", false)) return false;
+	return true;
+}
+
+bool negative()
+{
+	using Regexp = RegularExpression<Begin, NegSet<'x'>>;
+	if (!check<Regexp>("xa", false)) return false;
+	if (!check<Regexp>("ax", true)) return false;
+	using Middle = RegularExpression<Chr<'x'>, NegSet<'x'>>;
+	if (!check<Middle>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxa", true)) return false;
+	if (!check<Middle>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx", false)) return false;
+	return true;
+}
+
+bool insensitive()
+{
+	RegularExpression<Str<'a','b','c'>> regexp;
+	if (!regexp.match<caseInsensitive>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxABC")) return false;
+	if (regexp.match<caseSensitive>("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxABC")) return false;
+	return true;
+}
+
+int main ()
+{
+	if (!oneByte()) return 1;
+	if (!fewBytes()) return 1;
+	if (!table()) return 1;
+	if (!nullable()) return 1;
+	if (!negative()) return 1;
+	if (!insensitive()) return 1;
+	return 0;
+}
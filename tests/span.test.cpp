@@ -0,0 +1,71 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+// span reported by engine must be same as catch around whole regexp (End doesn't close catch, so it isn't used here)
+template <typename... Definition> bool sameAsCatch(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Definition...> regexp;
+	const RegularExpression<Definition...> shared{};
+	typename RegularExpression<Definition...>::Results results;
+	const RegularExpression<DynamicCatch<1, Definition...>> wrapped{};
+	typename RegularExpression<DynamicCatch<1, Definition...>>::Results catches;
+	return forRandomInputs(alphabet, 12, count, [&](const std::string & input)
+	{
+		const bool matched{wrapped.match(input, catches)};
+		if (regexp.match(input) != matched || shared.match(input, results) != matched) return false;
+		if (!matched) return true;
+		const Catch expected{catches.template getCatch<1>()[0]};
+		return regexp.position() == expected.begin && regexp.length() == expected.length && results.position() == expected.begin && results.length() == expected.length;
+	});
+}
+
+bool differential()
+{
+	// deterministic regexps (matched with DFA)
+	if (!sameAsCatch<Plus<CRange<'a','z'>>, Chr<'0'>>("ab0", 2000)) return false;
+	if (!sameAsCatch<Chr<'a'>, Repeat<2,3,Chr<'b'>>, Chr<'c'>>("abc", 2000)) return false;
+	if (!sameAsCatch<Star<Any>, Str<'x','y'>>("xyz", 2000)) return false;
+	if (!sameAsCatch<Opt<Chr<'-'>>, Plus<Number>, Opt<Chr<'.'>, Plus<Number>>>("-.12", 2000)) return false;
+	if (!sameAsCatch<Star<Chr<'a'>>>("ab", 500)) return false;
+	// with identifier (matched with backtracking)
+	if (!sameAsCatch<Id<1,1>, Plus<Number>, Chr<'.'>>("1.a", 2000)) return false;
+	return true;
+}
+
+bool whole()
+{
+	RegularExpression<Plus<Number>> regexp;
+	const std::string input{"abc 12345 def"};
+	if (!regexp.match(input)) return false;
+	if (regexp.position() != 4 || regexp.length() != 5) return false;
+	if (regexp.whole(input) != "12345") return false;
+	// span ends at end of input
+	RegularExpression<Plus<Number>, End> last;
+	if (!last.match(input + " 678")) return false;
+	if (last.position() != 14 || last.length() != 3) return false;
+	return true;
+}
+
+// span isn't left from previous match
+bool fresh()
+{
+	RegularExpression<Plus<Number>> deterministic;
+	if (!deterministic.match(std::string{"abc 123"}) || deterministic.position() != 4) return false;
+	if (!deterministic.hasSpan()) return false;
+	// DFA doesn't know span
+	if (!deterministic(std::string{"12 abc"}) || deterministic.hasSpan() || deterministic.position() != 0 || deterministic.length() != 0) return false;
+	if (!deterministic.match(std::string{"abc 123"}) || deterministic(std::string{"abc"}) || deterministic.hasSpan() || deterministic.length() != 0) return false;
+	RegularExpression<OneCatch<1, Plus<Number>>> catches;
+	if (!catches(std::string{"abc 123"}) || !catches.hasSpan() || catches.position() != 4 || catches.getCatch<1>().size() != 1) return false;
+	return !catches(std::string{"abc"}) && !catches.hasSpan() && catches.length() == 0 && catches.getCatch<1>().size() == 0;
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!whole()) return 1;
+	if (!fresh()) return 1;
+	return 0;
+}
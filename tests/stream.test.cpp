@@ -0,0 +1,83 @@
+#include "regexp/regexp.hpp"
+#include "tests/random.hpp"
+
+using namespace SRX;
+
+// input is split into random pieces, match is found at end of shortest prefix which contains it
+template <typename... Definition> bool sameResults(const char * alphabet, unsigned int count)
+{
+	RegularExpression<Definition...> regexp;
+	typename RegularExpression<Definition...>::template Stream<> stream;
+	Random pieces{count};
+	return forRandomInputs(alphabet, 16, count, [&](const std::string & input)
+	{
+		stream.reset();
+		for (size_t pos{0}; pos < input.size(); )
+		{
+			const size_t size{std::min<size_t>(pieces.next(4), input.size() - pos)};
+			stream.feed(input.data() + pos, size);
+			pos += size;
+		}
+		const bool matched{stream.finish()};
+		size_t end{0};
+		while (end <= input.size() && !regexp(input.substr(0, end))) ++end;
+		return matched == regexp(input) && (!matched || stream.offset() == end) && stream.size() == input.size();
+	});
+}
+
+bool differential()
+{
+	if (!sameResults<Str<'a','b','c'>>("abc", 2000)) return false;
+	if (!sameResults<Begin, Plus<Chr<'a'>>, Chr<'b'>>("ab", 2000)) return false;
+	if (!sameResults<Selection<Str<'A','B','C'>, Str<'B','C','D'>, Repeat<3,0,Chr<'A'>>>>("ABCD", 2000)) return false;
+	if (!sameResults<Chr<'x'>, Star<Any>, Chr<'y'>>("xyz", 2000)) return false;
+	return true;
+}
+
+bool anchors()
+{
+	RegularExpression<Str<'a','b'>, End>::Stream<> stream;
+	stream.feed("xxa", 3);
+	if (stream.feed("b", 1)) return false;
+	if (!stream.finish() || stream.offset() != 4) return false;
+	stream.reset();
+	stream.feed("ab", 2);
+	stream.feed("c", 1);
+	if (stream.finish()) return false;
+	return true;
+}
+
+bool caseInsensitivity()
+{
+	RegularExpression<Str<'a','b','c'>>::Stream<caseInsensitive> stream;
+	stream.feed(std::string{"xxA"});
+	stream.feed(std::string{"Bc"});
+	if (!stream.found() || stream.offset() != 5) return false;
+	return true;
+}
+
+bool bigAutomaton()
+{
+	// DFA for a[ab]{13}c would have too many states, stream refuses input instead of keeping it whole
+	using Regexp = RegularExpression<Chr<'a'>, Repeat<13,13,Chr<'a','b'>>, Chr<'c'>>;
+	Regexp::Stream<> stream;
+	if (stream.valid()) return false;
+	const std::string input{"bbbbabababababababcbbb"};
+	for (char c: input)
+	{
+		if (stream.feed(&c, 1)) return false;
+	}
+	if (stream.found() || stream.finish() || stream.size() != 0) return false;
+	// regexp itself matches whole input with backtracking
+	if (!Regexp{}(input)) return false;
+	return RegularExpression<Str<'a','b','c'>>::Stream<>{}.valid();
+}
+
+int main ()
+{
+	if (!differential()) return 1;
+	if (!anchors()) return 1;
+	if (!caseInsensitivity()) return 1;
+	if (!bigAutomaton()) return 1;
+	return 0;
+}